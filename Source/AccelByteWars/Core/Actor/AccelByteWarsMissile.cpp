@@ -7,6 +7,7 @@
 #include "AccelByteWarsCrateBase.h"
 #include "AccelByteWarsFxActor.h"
 #include "AccelByteWarsMissileTrail.h"
+#include "AccelByteWarsMissileTrailPool.h"
 #include "Core/Player/AccelByteWarsPlayerPawn.h"
 #include "Core/Player/AccelByteWarsPlayerController.h"
 #include "Core/Player/AccelByteWarsBotController.h"
@@ -61,6 +62,9 @@ void AAccelByteWarsMissile::BeginPlay()
 	// Ensure near hit ship list is empty on start
 	NearHitShips.Empty();
 
+	// Trails are cosmetic, each client spawns its own.
+	SpawnMissileTrail();
+
 	// Get Game State
 	AAccelByteWarsInGameGameState* ABGameState = Cast<AAccelByteWarsInGameGameState>(UGameplayStatics::GetGameState(GetWorld()));
 	if (ABGameState == nullptr)
@@ -79,14 +83,14 @@ void AAccelByteWarsMissile::BeginPlay()
 		return;
 	}
 	ABGameMode->SetupGameplayObject(this);
-
-	SpawnMissileTrail();
 }
 
 void AAccelByteWarsMissile::Destroyed()
 {
 	Super::Destroyed();
 
+	ReleaseMissileTrail();
+
 	if (!HasAuthority() || !Owner)
 	{
 		return;
@@ -129,6 +133,7 @@ void AAccelByteWarsMissile::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
 	DOREPLIFETIME(AAccelByteWarsMissile, Color);
+	DOREPLIFETIME(AAccelByteWarsMissile, TrailFx);
 	DOREPLIFETIME(AAccelByteWarsMissile, Velocity);
 	DOREPLIFETIME(AAccelByteWarsMissile, GravityForce);
 }
@@ -367,9 +372,9 @@ void AAccelByteWarsMissile::OnRepNotify_Color()
 	MissileThrustFx->SetVariableLinearColor(FName(NiagaraVariableColorName), Color);
 	MissileExpiredFx->SetVariableLinearColor(FName(NiagaraVariableColorName), Color);
 
-	if (HasAuthority())
+	if (MissileTrail)
 	{
-		MissileTrail->Server_SetColor(Color);
+		MissileTrail->SetTrailColor(Color);
 	}
 }
 
@@ -377,6 +382,14 @@ void AAccelByteWarsMissile::OnRepNotify_Velocity()
 {
 }
 
+void AAccelByteWarsMissile::OnRepNotify_TrailFx()
+{
+	if (MissileTrail && TrailFx)
+	{
+		MissileTrail->SetNiagaraFx(TrailFx);
+	}
+}
+
 void AAccelByteWarsMissile::SetVelocity()
 {
 	Velocity = InitialSpeed * GetActorTransform().GetRotation().GetRightVector();
@@ -546,10 +559,15 @@ void AAccelByteWarsMissile::DestroyOnOutOfBounds()
 
 void AAccelByteWarsMissile::SetNiagaraFx(UNiagaraSystem* NewTrailFx)
 {
-	if (NewTrailFx)
+	if (!HasAuthority() || !NewTrailFx)
 	{
-		MissileTrail->SetNiagaraFx(NewTrailFx);
+		return;
 	}
+
+	TrailFx = NewTrailFx;
+
+	// Listen servers and standalone games don't receive rep notifies, apply the trail locally.
+	OnRepNotify_TrailFx();
 }
 
 void AAccelByteWarsMissile::DestroyByPowerUp()
@@ -771,49 +789,36 @@ void AAccelByteWarsMissile::NotifyShipHitByMissile() const
 	}
 }
 
-void AAccelByteWarsMissile::SpawnMissileTrail(const TObjectPtr<UNiagaraSystem> TrailFx)
+void AAccelByteWarsMissile::SpawnMissileTrail()
 {
-	if (!HasAuthority() || !IsValid(MissileTrailActor))
+	if (MissileTrail || !IsValid(MissileTrailActor))
 	{
 		return;
 	}
 
-	FActorSpawnParameters SpawnParameters;
-	SpawnParameters.Owner = this;
-	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-	SpawnParameters.CustomPreSpawnInitalization = [TrailFx](AActor* SpawnedActor)
-	{
-		// Set the trail effect if any.
-		AAccelByteWarsMissileTrail* PreMissileTrail = Cast<AAccelByteWarsMissileTrail>(SpawnedActor);
-		if (TrailFx && PreMissileTrail)
-		{
-			PreMissileTrail->SetNiagaraFx(TrailFx);
-		}
-	};
-
-	// Spawn the trail at the missile's transform so clients without an Owner reference yet still get correct start position.
-	FTransform TrailTransform{ GetActorRotation(), GetActorLocation() };
-
 	UWorld* World = GetWorld();
 	if (!World)
 	{
 		return;
 	}
 
-	// Normal spawn to avoid pre-init replication warnings.
-	MissileTrail = World->SpawnActor<AAccelByteWarsMissileTrail>(
-		MissileTrailActor,
-		TrailTransform,
-		SpawnParameters);
+	// The pool is not created on dedicated servers, so the server does no trail work.
+	UAccelByteWarsMissileTrailPool* TrailPool = World->GetSubsystem<UAccelByteWarsMissileTrailPool>();
+	if (!TrailPool)
+	{
+		return;
+	}
 
+	MissileTrail = TrailPool->AcquireMissileTrail(MissileTrailActor, this, TrailFx, Color);
+}
+
+void AAccelByteWarsMissile::ReleaseMissileTrail()
+{
 	if (!MissileTrail)
 	{
 		return;
 	}
 
-	MissileTrail->AttachToActor(this, FAttachmentTransformRules::SnapToTargetIncludingScale);
-	MissileTrail->SetReplicateMovement(false);
-	MissileTrail->SetNetDormancy(DORM_Awake);
-	MissileTrail->ForceNetUpdate();
-	ForceNetUpdate();
+	MissileTrail->ReleaseTrail();
+	MissileTrail = nullptr;
 }
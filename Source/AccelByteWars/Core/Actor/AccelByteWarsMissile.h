@@ -325,6 +325,18 @@ protected:
 	UFUNCTION()
 	void OnRepNotify_Velocity();
 
+	/**
+	 * @brief Niagara system of the missile trail, replicated so each client can spawn the trail locally
+	 */
+	UPROPERTY(ReplicatedUsing = OnRepNotify_TrailFx)
+	UNiagaraSystem* TrailFx = nullptr;
+
+	/**
+	 * @brief Generic on rep notify for the missile trail fx
+	 */
+	UFUNCTION()
+	void OnRepNotify_TrailFx();
+
 	/**
 	 * @brief Calculates the distance between objects in 2D space
 	 */
@@ -349,7 +361,15 @@ private:
 	UPROPERTY()
 	AAccelByteWarsMissileTrail* MissileTrail = nullptr;
 
-	void SpawnMissileTrail(const TObjectPtr<UNiagaraSystem> TrailFx = nullptr);
+	/**
+	 * @brief Take a trail from the client-side pool and attach it to this missile. Does nothing on dedicated servers.
+	 */
+	void SpawnMissileTrail();
+
+	/**
+	 * @brief Detach the trail from this missile and let it fade out back into the pool.
+	 */
+	void ReleaseMissileTrail();
 
 	bool bIsMissileExpired{ false };
 };
@@ -3,6 +3,7 @@
 // and restrictions contact your company contract manager.
 
 #include "Core/Actor/AccelByteWarsMissileTrail.h"
+#include "Core/Actor/AccelByteWarsMissileTrailPool.h"
 
 #include "Core/Utilities/AccelByteWarsUtilityLog.h"
 
@@ -10,77 +11,85 @@ DEFINE_LOG_CATEGORY(LogMissileTrail);
 
 AAccelByteWarsMissileTrail::AAccelByteWarsMissileTrail()
 {
-	// Attach component in the BeginPlay to make sure the starting position is in the correct position.
+	// The component is activated when the trail is started, to make sure the starting position is in the correct position.
 	MissileTrail = CreateDefaultSubobject<UNiagaraComponent>(TEXT("ParticleSystem"));
 	MissileTrail->SetAutoActivate(false);
 	TrailFx = MissileTrail->GetAsset();
 	RootComponent = MissileTrail;
 
-	// Set this actor to call Tick() every frame.  You can turn this off to improve performance if you don't need it.
+	// The trail only needs to tick while fading out, the tick is enabled when the trail is released.
 	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
 
-	// Replicate trail so clients see it; set here to avoid pre-init SetReplicates warnings when using deferred spawn.
-	bReplicates = true;
+	// Trails are cosmetic and spawned locally by each client.
+	bReplicates = false;
 }
 
 void AAccelByteWarsMissileTrail::OnConstruction(const FTransform& Transform)
 {
 	Super::OnConstruction(Transform);
-	OnRepNotify_Color();
+	ApplyTrailColor();
 }
 
 void AAccelByteWarsMissileTrail::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Make sure the niagara component is in the correct position before activating particle.
-	// Owner/attachment might not be replicated to clients yet on first spawn; only activate when one is valid.
-	if (AActor* AttachParent = GetAttachParentActor())
-	{
-		MissileTrail->SetWorldLocation(AttachParent->GetActorLocation());
-		MissileTrail->Activate();
-	}
-	else if (AActor* LocalOwner = GetOwner())
-	{
-		MissileTrail->SetWorldLocation(LocalOwner->GetActorLocation());
-		MissileTrail->Activate();
-	}
-	else
-	{
-		// No valid reference yet; wait for Tick to activate when attachment/owner becomes valid.
-		MissileTrail->SetWorldLocation(GetActorLocation());
-	}
-
 	// Set component's color in case the class member was set before this.
-	OnRepNotify_Color();
+	ApplyTrailColor();
 	SetRibbonAlpha(CurrentAlpha);
+}
 
-	if (!HasAuthority())
+void AAccelByteWarsMissileTrail::StartTrail(AActor* InMissile, UNiagaraSystem* NewFx, const FLinearColor& InColor)
+{
+	if (!InMissile)
 	{
 		return;
 	}
 
-	// Destroy self if owner destroyed or if there's no owner to avoid "zombie" trail.
-	if (AActor* LocalOwner = GetOwner())
-	{
-		if (!bOwnerDestroyBound)
-		{
-			LocalOwner->OnDestroyed.AddDynamic(this, &ThisClass::OnOwnerDestroyed);
-			bOwnerDestroyBound = true;
-		}
-	}
-	else
+	bIsIdle = false;
+
+	// Reset the fade out state in case this trail is reused.
+	CurrentAlpha = GetClass()->GetDefaultObject<AAccelByteWarsMissileTrail>()->CurrentAlpha;
+	WantedAlpha = GetClass()->GetDefaultObject<AAccelByteWarsMissileTrail>()->WantedAlpha;
+	DelayedFadeOutCurrentTime = 0.0f;
+	bFadeOutDelayStarted = false;
+	SetActorTickEnabled(false);
+
+	// Make sure the niagara component is in the correct position before activating particle.
+	AttachToActor(InMissile, FAttachmentTransformRules::SnapToTargetIncludingScale);
+	MissileTrail->SetWorldLocation(InMissile->GetActorLocation());
+	SetActorHiddenInGame(false);
+
+	if (NewFx && NewFx != MissileTrail->GetAsset())
 	{
-		// Owner might not be replicated on clients yet; don't destroy here. We'll attempt to bind in Tick when owner becomes valid.
+		TrailFx = NewFx;
+		DefaultRate.Reset();
+		MissileTrail->SetAsset(TrailFx);
 	}
+
+	TrailColor = InColor;
+	MissileTrail->Activate(true);
+	SetRibbonRate(-1.0f);
+	ApplyTrailColor();
+	SetRibbonAlpha(CurrentAlpha);
 }
 
-void AAccelByteWarsMissileTrail::OnOwnerDestroyed(AActor* InActor)
+void AAccelByteWarsMissileTrail::ReleaseTrail()
 {
-	bFadeOutDelayStarted = true;
+	if (bIsIdle || bFadeOutDelayStarted)
+	{
+		return;
+	}
+
+	// Leave the trail where the missile was destroyed.
+	DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
 
 	// Stop emitting.
-	MissileTrail->SetVariableFloat(FName(NiagaraVariableRateName), 0.0f);
+	SetRibbonRate(0.0f);
+
+	bFadeOutDelayStarted = true;
+	SetActorTickEnabled(true);
 }
 
 void AAccelByteWarsMissileTrail::Tick(float DeltaTime)
@@ -107,55 +116,30 @@ void AAccelByteWarsMissileTrail::Tick(float DeltaTime)
 		SetRibbonAlpha(CurrentAlpha);
 	}
 
-	// If we haven't activated yet or bound due to missing owner/attachment at BeginPlay, try again now.
-	if (!MissileTrail->IsActive())
-	{
-		if (AActor* AttachParent = GetAttachParentActor())
-		{
-			MissileTrail->SetWorldLocation(AttachParent->GetActorLocation());
-			MissileTrail->Activate();
-			OnRepNotify_Color();
-			SetRibbonAlpha(CurrentAlpha);
-		}
-		else if (AActor* LocalOwner = GetOwner())
-		{
-			MissileTrail->SetWorldLocation(LocalOwner->GetActorLocation());
-			MissileTrail->Activate();
-			OnRepNotify_Color();
-			SetRibbonAlpha(CurrentAlpha);
-		}
-	}
-
-	if (!bOwnerDestroyBound)
-	{
-		if (AActor* LocalOwner = GetOwner())
-		{
-			LocalOwner->OnDestroyed.AddDynamic(this, &ThisClass::OnOwnerDestroyed);
-			bOwnerDestroyBound = true;
-		}
-	}
-
-	// Destroy logic.
+	// Return to pool logic.
 	// Lerp function used, uses DeltaTime as the weight. CurrentAlpha might never reach exactly 0.
 	if (FMath::IsNearlyEqual(CurrentAlpha, 0.0, 0.00001))
 	{
-		Destroy();
+		ReturnToPool();
 	}
 }
 
-void AAccelByteWarsMissileTrail::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+void AAccelByteWarsMissileTrail::ReturnToPool()
 {
-	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-
-	DOREPLIFETIME(AAccelByteWarsMissileTrail, TrailColor);
-	DOREPLIFETIME(AAccelByteWarsMissileTrail, bFadeOutDelayStarted);
-}
+	MissileTrail->DeactivateImmediate();
+	SetActorHiddenInGame(true);
+	SetActorTickEnabled(false);
+	bFadeOutDelayStarted = false;
+	bIsIdle = true;
 
-void AAccelByteWarsMissileTrail::Destroyed()
-{
-	RootComponent->Deactivate();
+	UAccelByteWarsMissileTrailPool* TrailPool = GetWorld() ? GetWorld()->GetSubsystem<UAccelByteWarsMissileTrailPool>() : nullptr;
+	if (!TrailPool)
+	{
+		Destroy();
+		return;
+	}
 
-	Super::Destroyed();
+	TrailPool->ReturnMissileTrail(this);
 }
 
 bool AAccelByteWarsMissileTrail::IsFadeOut()
@@ -171,13 +155,13 @@ void AAccelByteWarsMissileTrail::TriggerFadeOut()
 	WantedAlpha = 0.0f;
 }
 
-void AAccelByteWarsMissileTrail::Server_SetColor_Implementation(FLinearColor InColor)
+void AAccelByteWarsMissileTrail::SetTrailColor(const FLinearColor& InColor)
 {
 	TrailColor = InColor;
-	OnRepNotify_Color();
+	ApplyTrailColor();
 }
 
-void AAccelByteWarsMissileTrail::OnRepNotify_Color()
+void AAccelByteWarsMissileTrail::ApplyTrailColor() const
 {
 	if (!MissileTrail)
 	{
@@ -192,31 +176,40 @@ void AAccelByteWarsMissileTrail::SetRibbonAlpha(const float Alpha) const
 	MissileTrail->SetVariableFloat(FName(NiagaraVariableAlphaName), Alpha);
 }
 
-void AAccelByteWarsMissileTrail::SetNiagaraFx(UNiagaraSystem* NewFx)
+void AAccelByteWarsMissileTrail::SetRibbonRate(const float Rate)
 {
-	if (!HasAuthority())
-	{
-		return;
-	}
-
-	TrailFx = NewFx;
+	const FNiagaraVariable RateVariable(FNiagaraTypeDefinition::GetFloatDef(), FName(NiagaraVariableRateName));
 
-	if (!IsRunningDedicatedServer())
+	// Cache the rate of the niagara system before overriding it for the first time.
+	if (!DefaultRate.IsSet())
 	{
-		OnRepNotify_TrailFx();
+		if (Rate < 0.0f)
+		{
+			return;
+		}
+
+		DefaultRate = MissileTrail->GetOverrideParameters().GetParameterValue<float>(RateVariable);
 	}
+
+	MissileTrail->SetVariableFloat(RateVariable.GetName(), Rate < 0.0f ? DefaultRate.GetValue() : Rate);
 }
 
-void AAccelByteWarsMissileTrail::OnRepNotify_TrailFx()
+void AAccelByteWarsMissileTrail::SetNiagaraFx(UNiagaraSystem* NewFx)
 {
-	if (!MissileTrail || !MissileTrail->IsRegistered() || !TrailFx)
+	if (!NewFx || !MissileTrail || !MissileTrail->IsRegistered() || NewFx == TrailFx)
 	{
 		return;
 	}
 
+	TrailFx = NewFx;
+
+	// The rate of the previous niagara system doesn't apply to the new one.
+	DefaultRate.Reset();
+
 	MissileTrail->DeactivateImmediate();
 	MissileTrail->SetAsset(TrailFx);
 	MissileTrail->Activate();
 
+	ApplyTrailColor();
 	SetRibbonAlpha(CurrentAlpha);
 }
@@ -7,34 +7,47 @@
 #include "NiagaraComponent.h"
 #include "Kismet/KismetMathLibrary.h"
 
-#include "Net/UnrealNetwork.h"
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "AccelByteWarsMissileTrail.generated.h"
 
 ACCELBYTEWARS_API DECLARE_LOG_CATEGORY_EXTERN(LogMissileTrail, Log, All);
 
+/**
+ * @brief Client-side cosmetic trail of a missile. It is not replicated: each client takes one from the
+ * UAccelByteWarsMissileTrailPool when the missile begins play and releases it when the missile is destroyed.
+ * The trail only ticks while it is fading out, then it goes back to the pool.
+ */
 UCLASS()
 class ACCELBYTEWARS_API AAccelByteWarsMissileTrail : public AActor
 {
 	GENERATED_BODY()
 
-	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
-	virtual void Destroyed() override;
-
 public:
 	AAccelByteWarsMissileTrail();
 	virtual void OnConstruction(const FTransform& Transform) override;
 	void SetNiagaraFx(UNiagaraSystem* NewFx);
 
+	/**
+	 * @brief Attach the trail to the missile and start emitting with the given effect and color.
+	 */
+	void StartTrail(AActor* InMissile, UNiagaraSystem* NewFx, const FLinearColor& InColor);
+
+	/**
+	 * @brief Detach the trail from its missile, stop emitting and fade out before going back to the pool.
+	 */
+	void ReleaseTrail();
+
+	/**
+	 * @brief Returns true if the trail is not in use by any missile.
+	 */
+	bool IsTrailIdle() const { return bIsIdle; }
+
 protected:
 	//~UObject overridden functions
 	virtual void BeginPlay() override;
 	//~End of UObject overridden functions
 
-	UFUNCTION()
-	void OnOwnerDestroyed(AActor* InActor);
-
 public:
 	//~UObject overridden functions
 	virtual void Tick(float DeltaTime) override;
@@ -70,7 +83,7 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AccelByteWars)
 	float DelayedFadeOutCurrentTime = 0.0f;
 
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Replicated, Category = AccelByteWars)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = AccelByteWars)
 	bool bFadeOutDelayStarted = false;
 
 	/**
@@ -80,29 +93,22 @@ public:
 	void TriggerFadeOut();
 
 	/**
-	 * @brief Lets other players know the color of the missile trail
+	 * @brief Set the color of the missile trail
 	 */
-	UFUNCTION(BlueprintCallable, Server, Unreliable, Category = AccelByteWars)
-	void Server_SetColor(FLinearColor InColor);
+	UFUNCTION(BlueprintCallable, Category = AccelByteWars)
+	void SetTrailColor(const FLinearColor& InColor);
 
 protected:
 	/**
 	 * @brief Current missile trail color
 	 */
-	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = AccelByteWars, ReplicatedUsing = OnRepNotify_Color)
+	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category = AccelByteWars)
 	FLinearColor TrailColor = FLinearColor::White;
 
 	/**
-	 * @brief Generic on rep notify for the missile trail color
-	 */
-	UFUNCTION()
-	void OnRepNotify_Color();
-
-	/**
-	 * @brief Generic on rep notify for the missile trail fx
+	 * @brief Apply the missile trail color to the niagara component
 	 */
-	UFUNCTION()
-	void OnRepNotify_TrailFx();
+	void ApplyTrailColor() const;
 
 	/**
 	 * @brief Returns true if the missile trail is faded out
@@ -115,7 +121,17 @@ protected:
 	 */
 	void SetRibbonAlpha(const float Alpha) const;
 
-	UPROPERTY(ReplicatedUsing = OnRepNotify_TrailFx)
+	/**
+	 * @brief Set the spawn rate of the trail. The rate of the niagara system is used if negative.
+	 */
+	void SetRibbonRate(const float Rate);
+
+	/**
+	 * @brief Hide the trail and give it back to the pool.
+	 */
+	void ReturnToPool();
+
+	UPROPERTY()
 	UNiagaraSystem* TrailFx;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
@@ -128,6 +144,8 @@ protected:
 	FString NiagaraVariableAlphaName;
 
 private:
-	// Ensures we only bind once to the owner's OnDestroyed delegate when Owner becomes available on clients.
-	bool bOwnerDestroyBound = false;
+	// Spawn rate of the niagara system, cached before it is overridden to stop emitting so reused trails can restore it.
+	TOptional<float> DefaultRate;
+
+	bool bIsIdle = true;
 };
@@ -0,0 +1,100 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/Actor/AccelByteWarsMissileTrailPool.h"
+#include "Core/Actor/AccelByteWarsMissileTrail.h"
+
+bool UAccelByteWarsMissileTrailPool::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Check the world instead of the process, so a dedicated server running in a single-process PIE session is skipped too.
+	const UWorld* World = Cast<UWorld>(Outer);
+	if (!World || World->GetNetMode() == NM_DedicatedServer)
+	{
+		return false;
+	}
+
+	return Super::ShouldCreateSubsystem(Outer);
+}
+
+bool UAccelByteWarsMissileTrailPool::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAccelByteWarsMissileTrailPool::Deinitialize()
+{
+	IdleTrails.Empty();
+
+	Super::Deinitialize();
+}
+
+AAccelByteWarsMissileTrail* UAccelByteWarsMissileTrailPool::AcquireMissileTrail(
+	const TSubclassOf<AAccelByteWarsMissileTrail> TrailClass,
+	AActor* Missile,
+	UNiagaraSystem* TrailFx,
+	const FLinearColor& TrailColor)
+{
+	if (!TrailClass.Get() || !Missile)
+	{
+		return nullptr;
+	}
+
+	// Reuse an idle trail of the same class if any.
+	AAccelByteWarsMissileTrail* Trail = nullptr;
+	for (int32 Index = IdleTrails.Num() - 1; Index >= 0; --Index)
+	{
+		AAccelByteWarsMissileTrail* IdleTrail = IdleTrails[Index];
+		if (!IsValid(IdleTrail))
+		{
+			IdleTrails.RemoveAtSwap(Index);
+			continue;
+		}
+
+		if (IdleTrail->GetClass() == TrailClass.Get())
+		{
+			IdleTrails.RemoveAtSwap(Index);
+			Trail = IdleTrail;
+			break;
+		}
+	}
+
+	if (!Trail)
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		Trail = GetWorld()->SpawnActor<AAccelByteWarsMissileTrail>(
+			TrailClass.Get(),
+			FTransform{ Missile->GetActorRotation(), Missile->GetActorLocation() },
+			SpawnParameters);
+		if (!Trail)
+		{
+			UE_LOG(LogMissileTrail, Warning, TEXT("Failed to spawn missile trail %s."), *TrailClass->GetName());
+			return nullptr;
+		}
+	}
+
+	Trail->SetOwner(Missile);
+	Trail->StartTrail(Missile, TrailFx, TrailColor);
+
+	return Trail;
+}
+
+void UAccelByteWarsMissileTrailPool::ReturnMissileTrail(AAccelByteWarsMissileTrail* Trail)
+{
+	if (!IsValid(Trail))
+	{
+		return;
+	}
+
+	Trail->SetOwner(nullptr);
+
+	if (IdleTrails.Num() >= MISSILE_TRAIL_POOL_MAX_SIZE)
+	{
+		Trail->Destroy();
+		return;
+	}
+
+	IdleTrails.AddUnique(Trail);
+}
@@ -0,0 +1,50 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AccelByteWarsMissileTrailPool.generated.h"
+
+class AAccelByteWarsMissileTrail;
+class UNiagaraSystem;
+
+// Maximum number of idle missile trails kept for reuse, any trail returned beyond this is destroyed.
+#define MISSILE_TRAIL_POOL_MAX_SIZE 32
+
+/**
+ * @brief Pool of the client-side missile trails of a world.
+ * Not created on dedicated servers, since the trails are purely cosmetic.
+ */
+UCLASS()
+class ACCELBYTEWARS_API UAccelByteWarsMissileTrailPool : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * @brief Take an idle trail of the given class from the pool, or spawn a new one, and start it on the missile.
+	 */
+	AAccelByteWarsMissileTrail* AcquireMissileTrail(
+		const TSubclassOf<AAccelByteWarsMissileTrail> TrailClass,
+		AActor* Missile,
+		UNiagaraSystem* TrailFx,
+		const FLinearColor& TrailColor);
+
+	/**
+	 * @brief Give back a trail that finished fading out so it can be reused.
+	 */
+	void ReturnMissileTrail(AAccelByteWarsMissileTrail* Trail);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	UPROPERTY()
+	TArray<TObjectPtr<AAccelByteWarsMissileTrail>> IdleTrails;
+};
@@ -11,6 +11,7 @@
 #include "Widgets/Notifications/SNotificationList.h"
 #include "Framework/Notifications/NotificationManager.h"
 #include "JsonObjectConverter.h"
+#include "Algo/BinarySearch.h"
 #include "Core/GameModes/AccelByteWarsGameMode.h"
 #include "Core/Utilities/AccelByteWarsUtility.h"
 
@@ -29,6 +30,11 @@ TArray<FFTUEDialogueModel*> UTutorialModuleDataAsset::CachedFTUEDialogues;
 
 TMultiMap<FString, UGUICheatWidgetEntry*> UTutorialModuleDataAsset::CachedGUICheatEntries;
 
+bool UTutorialModuleDataAsset::bIsMetadataIndexDirty = true;
+TMap<FString, FTutorialModuleGeneratedWidget*> UTutorialModuleDataAsset::CachedGeneratedWidgetsById;
+TMap<FString, FWidgetValidator*> UTutorialModuleDataAsset::CachedWidgetValidatorsById;
+TMap<FString, FFTUEDialogueModel*> UTutorialModuleDataAsset::CachedFTUEDialoguesById;
+
 UTutorialModuleDataAsset::UTutorialModuleDataAsset() 
 {
 	AssetType = UTutorialModuleDataAsset::TutorialModuleAssetType;
@@ -590,13 +596,20 @@ void UTutorialModuleDataAsset::ValidateGeneratedWidgets()
 				{
 					continue;
 				}
-				TargetWidgetClass.GetDefaultObject()->GeneratedWidgets.Add(&GeneratedWidget);
+				// Keep the target's generated widgets ordered by spawn order, so the widget doesn't need to sort them on every activation.
+				TArray<FTutorialModuleGeneratedWidget*>& TargetGeneratedWidgets = TargetWidgetClass.GetDefaultObject()->GeneratedWidgets;
+				const int32 InsertIndex = Algo::UpperBound(TargetGeneratedWidgets, &GeneratedWidget, [](const FTutorialModuleGeneratedWidget* A, const FTutorialModuleGeneratedWidget* B)
+				{
+					return *A < *B;
+				});
+				TargetGeneratedWidgets.Insert(&GeneratedWidget, InsertIndex);
 				CachedGeneratedWidgets.Add(&GeneratedWidget);
 			}
 		}
 	}
 
 	LastGeneratedWidgets = GeneratedWidgets;
+	MarkMetadataIndexDirty();
 }
 #pragma endregion
 
@@ -795,6 +808,7 @@ void UTutorialModuleDataAsset::ValidateFTUEDialogues()
 
 	// Save dialogues cache for clean-up later.
 	LastFTUEDialogueGroups = FTUEDialogueGroups;
+	MarkMetadataIndexDirty();
 }
 #pragma endregion
 
@@ -928,6 +942,73 @@ void UTutorialModuleDataAsset::ValidateWidgetValidators()
 	}
 
 	LastWidgetValidators = WidgetValidators;
+	MarkMetadataIndexDirty();
+}
+#pragma endregion
+
+#pragma region "Metadata Index"
+FTutorialModuleGeneratedWidget* UTutorialModuleDataAsset::FindCachedGeneratedWidgetById(const FString& WidgetId)
+{
+	RebuildMetadataIndexIfDirty();
+	FTutorialModuleGeneratedWidget** Found = CachedGeneratedWidgetsById.Find(WidgetId);
+	return Found ? *Found : nullptr;
+}
+
+FWidgetValidator* UTutorialModuleDataAsset::FindCachedWidgetValidatorById(const FString& WidgetValidatorId)
+{
+	RebuildMetadataIndexIfDirty();
+	FWidgetValidator** Found = CachedWidgetValidatorsById.Find(WidgetValidatorId);
+	return Found ? *Found : nullptr;
+}
+
+FFTUEDialogueModel* UTutorialModuleDataAsset::FindCachedFTUEDialogueById(const FString& FTUEId)
+{
+	RebuildMetadataIndexIfDirty();
+	FFTUEDialogueModel** Found = CachedFTUEDialoguesById.Find(FTUEId);
+	return Found ? *Found : nullptr;
+}
+
+void UTutorialModuleDataAsset::RebuildMetadataIndexIfDirty()
+{
+	if (!bIsMetadataIndexDirty)
+	{
+		return;
+	}
+	bIsMetadataIndexDirty = false;
+
+	// The first cached metadata with the id wins, the same as searching the cached metadata in order.
+	CachedGeneratedWidgetsById.Reset();
+	for (FTutorialModuleGeneratedWidget* Metadata : CachedGeneratedWidgets)
+	{
+		if (Metadata && !CachedGeneratedWidgetsById.Contains(Metadata->WidgetId))
+		{
+			CachedGeneratedWidgetsById.Add(Metadata->WidgetId, Metadata);
+		}
+	}
+
+	CachedWidgetValidatorsById.Reset();
+	for (FWidgetValidator* Metadata : CachedWidgetValidators)
+	{
+		if (Metadata && !CachedWidgetValidatorsById.Contains(Metadata->WidgetValidatorId))
+		{
+			CachedWidgetValidatorsById.Add(Metadata->WidgetValidatorId, Metadata);
+		}
+	}
+
+	CachedFTUEDialoguesById.Reset();
+	for (FFTUEDialogueModel* Metadata : CachedFTUEDialogues)
+	{
+		if (Metadata && !CachedFTUEDialoguesById.Contains(Metadata->FTUEId))
+		{
+			CachedFTUEDialoguesById.Add(Metadata->FTUEId, Metadata);
+		}
+	}
+
+	UE_LOG_TUTORIALMODULEDATAASSET(Log,
+		TEXT("Tutorial Module metadata index rebuilt. Generated widgets: %d, widget validators: %d, FTUE dialogues: %d."),
+		CachedGeneratedWidgetsById.Num(),
+		CachedWidgetValidatorsById.Num(),
+		CachedFTUEDialoguesById.Num());
 }
 #pragma endregion
 
@@ -148,7 +148,7 @@ private:
 
 public:
 #pragma region "Generated Widgets"
-	static TArray<FTutorialModuleGeneratedWidget*> GetCachedGeneratedWidgets()
+	static const TArray<FTutorialModuleGeneratedWidget*>& GetCachedGeneratedWidgets()
 	{
 		return CachedGeneratedWidgets;
 	}
@@ -170,7 +170,7 @@ private:
 public:
 	bool HasFTUE();
 
-	static TArray<FFTUEDialogueModel*> GetCachedFTUEDialogues()
+	static const TArray<FFTUEDialogueModel*>& GetCachedFTUEDialogues()
 	{
 		return CachedFTUEDialogues;
 	}
@@ -209,12 +209,32 @@ public:
 
 	bool IsWidgetValidatorEnabled();
 
-	static TArray<FWidgetValidator*> GetCachedWidgetValidators()
+	static const TArray<FWidgetValidator*>& GetCachedWidgetValidators()
 	{
 		return CachedWidgetValidators;
 	}
 #pragma endregion
 
+#pragma region "Metadata Index"
+public:
+	static FTutorialModuleGeneratedWidget* FindCachedGeneratedWidgetById(const FString& WidgetId);
+	static FWidgetValidator* FindCachedWidgetValidatorById(const FString& WidgetValidatorId);
+	static FFTUEDialogueModel* FindCachedFTUEDialogueById(const FString& FTUEId);
+
+private:
+	/**
+	 * @brief Rebuild the id lookup tables of the cached metadata if any Tutorial Module revalidated its metadata since the last build.
+	 * The tables are only built on lookup, so they are built once after all Tutorial Modules are loaded.
+	 */
+	static void RebuildMetadataIndexIfDirty();
+	static void MarkMetadataIndexDirty() { bIsMetadataIndexDirty = true; }
+
+	static bool bIsMetadataIndexDirty;
+	static TMap<FString, FTutorialModuleGeneratedWidget*> CachedGeneratedWidgetsById;
+	static TMap<FString, FWidgetValidator*> CachedWidgetValidatorsById;
+	static TMap<FString, FFTUEDialogueModel*> CachedFTUEDialoguesById;
+#pragma endregion
+
 private:
 	void ValidateDataAssetProperties();
 
@@ -83,23 +83,7 @@ bool UTutorialModuleUtility::IsTutorialModuleActive(const FPrimaryAssetId Tutori
 
 FTutorialModuleGeneratedWidget* FTutorialModuleGeneratedWidget::GetMetadataById(const FString& WidgetId)
 {
-	FTutorialModuleGeneratedWidget* Result = nullptr;
-
-	for (const auto Metadata : UTutorialModuleDataAsset::GetCachedGeneratedWidgets()) 
-	{
-		if (!Metadata) 
-		{
-			continue;
-		}
-
-		if (Metadata->WidgetId.Equals(WidgetId)) 
-		{
-			Result = Metadata;
-			break;
-		}
-	}
-		
-	return Result;
+	return UTutorialModuleDataAsset::FindCachedGeneratedWidgetById(WidgetId);
 }
 
 UGUICheatWidgetEntry* FTutorialModuleGeneratedWidget::GetGUICheatMetadataById(const FString& Id)
@@ -70,10 +70,12 @@ void AAccelByteWarsGameMode::BeginPlay()
 	if (bIsGameplayLevel || IsServer())
 	{
 		// setup existing players
+		TArray<AController*> ExistingPlayers;
 		for(FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
 		{
-			PlayerTeamSetup(Iterator->Get());
+			ExistingPlayers.Add(Iterator->Get());
 		}
+		PlayerTeamSetupBatch(ExistingPlayers);
 	}
 
 	Super::BeginPlay();
@@ -100,10 +102,43 @@ void AAccelByteWarsGameMode::PostLogin(APlayerController* NewPlayer)
 		return;
 	}
 
+	// Setup the player right away if no batch window is open, otherwise setup with the other players logging in at the same time.
+	PendingTeamSetupPlayers.Add(NewPlayer);
+	if (!GetWorldTimerManager().IsTimerActive(PendingTeamSetupTimerHandle))
+	{
+		GetWorldTimerManager().SetTimer(PendingTeamSetupTimerHandle, this, &ThisClass::FlushPendingTeamSetup, TEAM_SETUP_BATCH_WINDOW, false);
+		FlushPendingTeamSetup();
+	}
+}
+
+void AAccelByteWarsGameMode::FlushPendingTeamSetup()
+{
+	// No player logged in during the batch window.
+	if (PendingTeamSetupPlayers.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<APlayerController*> Players;
+	for (const TWeakObjectPtr<APlayerController>& Player : PendingTeamSetupPlayers)
+	{
+		// Skip players that logged out while waiting.
+		if (Player.IsValid() && Player->PlayerState)
+		{
+			Players.Add(Player.Get());
+		}
+	}
+	PendingTeamSetupPlayers.Empty();
+
 	// Setup player if in the gameplay level and game started
 	if (bIsGameplayLevel || IsServer())
 	{
-		PlayerTeamSetup(NewPlayer);
+		PlayerTeamSetupBatch(TArray<AController*>(Players));
+	}
+
+	for (APlayerController* Player : Players)
+	{
+		OnPostLoginTeamSetupDone(Player);
 	}
 }
 
@@ -180,6 +215,7 @@ void AAccelByteWarsGameMode::PlayerTeamSetup(AController* Controller) const
 		if (AbPlayerState->GetUniqueId().IsValid() && !PlayerData->UniqueNetId.IsValid())
 		{
 			PlayerData->UniqueNetId = PlayerUniqueId;
+			ABGameState->InvalidateTeamsLookup();
 
 			// notify local
 			ABGameState->OnNotify_Teams();
@@ -298,6 +334,17 @@ void AAccelByteWarsGameMode::PlayerTeamSetup(AController* Controller) const
 		AbPlayerState->Deaths);
 }
 
+void AAccelByteWarsGameMode::PlayerTeamSetupBatch(const TArray<AController*>& Controllers) const
+{
+	// Lookups are indexed and the Teams changed notification is sent once, after all players are set up.
+	ABGameState->BeginTeamsUpdate();
+	for (AController* Controller : Controllers)
+	{
+		PlayerTeamSetup(Controller);
+	}
+	ABGameState->EndTeamsUpdate();
+}
+
 void AAccelByteWarsGameMode::DelayedPlayerTeamSetupWithPredefinedData(APlayerController* PlayerController)
 {
 	APlayerState* PlayerState = PlayerController->PlayerState;
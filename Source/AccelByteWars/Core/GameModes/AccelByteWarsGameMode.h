@@ -19,6 +19,9 @@ ACCELBYTEWARS_API DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteWarsGameMode, Log, All
 
 class AAccelByteWarsPlayerState;
 
+// A player logging in is set up right away and opens a window of this many seconds, the players logging in during it are set up in one pass when it ends.
+#define TEAM_SETUP_BATCH_WINDOW 0.1f
+
 #pragma region "Structs, Enums, and Delegates declaration"
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnPlayerPostLogin, APlayerController* /*NewPlayer*/);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnInitializeListenServer, FName /* SessionName */);
@@ -92,6 +95,16 @@ protected:
 
 	bool RemovePlayer(const APlayerController* PlayerController) const;
 
+	/**
+	 * @brief Setup the team of multiple players in one pass, with a single Teams changed notification
+	 */
+	void PlayerTeamSetupBatch(const TArray<AController*>& Controllers) const;
+
+	/**
+	 * @brief Called for each player logged in once the batched team setup of the player is done
+	 */
+	virtual void OnPostLoginTeamSetupDone(APlayerController* PlayerController) {}
+
 	UPROPERTY(EditDefaultsOnly)
 	bool bIsGameplayLevel = false;
 
@@ -115,6 +128,11 @@ private:
 	UFUNCTION()
 	void CloseGameInternal() const;
 
+	void FlushPendingTeamSetup();
+
+	TArray<TWeakObjectPtr<APlayerController>> PendingTeamSetupPlayers;
+	FTimerHandle PendingTeamSetupTimerHandle;
+
 	UPROPERTY()
 	AAccelByteWarsGameState* ABGameState = nullptr;
 
@@ -205,11 +205,11 @@ void AAccelByteWarsInGameGameMode::Tick(float DeltaSeconds)
 }
 // @@@SNIPEND
 
-void AAccelByteWarsInGameGameMode::PostLogin(APlayerController* NewPlayer)
+void AAccelByteWarsInGameGameMode::OnPostLoginTeamSetupDone(APlayerController* PlayerController)
 {
-	Super::PostLogin(NewPlayer);
+	Super::OnPostLoginTeamSetupDone(PlayerController);
 
-	APlayerState* PlayerState = NewPlayer->PlayerState;
+	APlayerState* PlayerState = PlayerController->PlayerState;
 	if (!PlayerState)
 	{
 		return;
@@ -607,6 +607,7 @@ void AAccelByteWarsInGameGameMode::RemoveFromActiveGameObjects(AActor* Destroyed
 			DestroyedActor->FindComponentByClass<UAccelByteWarsGameplayObjectComponent>())
 	{
 		ABInGameGameState->ActiveGameObjects.Remove(Component);
+		UnsplatSpawnSafetyObject(Component);
 	}
 }
 
@@ -699,13 +700,14 @@ void AAccelByteWarsInGameGameMode::StartGame()
 	}
 }
 
-void AAccelByteWarsInGameGameMode::SetupGameplayObject(AActor* Object) const
+void AAccelByteWarsInGameGameMode::SetupGameplayObject(AActor* Object)
 {
 	Object->SetReplicates(true);
 	if (UAccelByteWarsGameplayObjectComponent* Component =
 			Cast<UAccelByteWarsGameplayObjectComponent>(Object->GetComponentByClass(UAccelByteWarsGameplayObjectComponent::StaticClass())))
 	{
 		ABInGameGameState->ActiveGameObjects.Add(Component);
+		SplatSpawnSafetyObject(Component);
 	}
 
 	Object->OnDestroyed.AddDynamic(this, &ThisClass::RemoveFromActiveGameObjects);
@@ -817,6 +819,7 @@ void AAccelByteWarsInGameGameMode::FillEmptySlotWithBot()
 	if (CurrentPlayers < MaxPlayers)
 	{
 		const int32 BotsNeeded = MaxPlayers - CurrentPlayers;
+		TArray<AController*> Bots;
 		for (int32 Index = 0; Index < BotsNeeded; ++Index)
 		{
 			AAccelByteWarsBotController* BotController = GetWorld()->SpawnActor<AAccelByteWarsBotController>(AAccelByteWarsBotController::StaticClass());
@@ -829,8 +832,10 @@ void AAccelByteWarsInGameGameMode::FillEmptySlotWithBot()
 			const FUniqueNetIdRef UniqueIdRef = FUniqueNetIdString::Create(BotId, FName(TEXT("BOT")));
 			BotController->PlayerState->SetUniqueId(FUniqueNetIdRepl(UniqueIdRef));
 
-			PlayerTeamSetup(BotController);
+			Bots.Add(BotController);
 		}
+
+		PlayerTeamSetupBatch(Bots);
 	}
 }
 
@@ -856,9 +861,8 @@ TArray<FVector> AAccelByteWarsInGameGameMode::GetActiveGameObjectsPosition() con
 
 bool AAccelByteWarsInGameGameMode::FindGoodSpawnLocation(FVector2D& OutCoord)
 {
-	if (!FindGoodSpawnLocation(
+	if (!FindGoodSpawnLocationInSafetyField(
 			OutCoord,
-			GetActiveGameObjectsPosition(),
 			ABInGameGameState->MinGameBound,
 			ABInGameGameState->MaxGameBound))
 	{
@@ -911,6 +915,9 @@ void AAccelByteWarsInGameGameMode::SpawnPlanets()
 		// In case issue "missile go through object" happened again
 		GAMEMODE_LOG(VeryVerbose, TEXT("Object spawned: %s | %f"), *SpawnedObject->GetName(), SpawnedObject->GetTransform().GetLocation().Z)
 	}
+
+	// Bake the planets into the spawn safety field of the play area, so mid-match spawns only need to sample it.
+	GetSpawnSafetyField(ABInGameGameState->MinGameBound, ABInGameGameState->MaxGameBound);
 }
 
 bool AAccelByteWarsInGameGameMode::FindGoodPlanetPosition(FVector& Position) const
@@ -971,7 +978,7 @@ bool AAccelByteWarsInGameGameMode::FindGoodPlanetPosition(FVector& Position) con
 	return true;
 }
 
-FVector AAccelByteWarsInGameGameMode::FindGoodPlayerPosition(APlayerState* PlayerState) const
+FVector AAccelByteWarsInGameGameMode::FindGoodPlayerPosition(APlayerState* PlayerState)
 {
 	FVector Position = FVector::ZeroVector;
 	FVector2D MaxBound;
@@ -1095,9 +1102,8 @@ FVector AAccelByteWarsInGameGameMode::FindGoodPlayerPosition(APlayerState* Playe
 	AdjustBounds(MinBound.Y, MaxBound.Y, MinGameBound.Y, MaxGameBound.Y);
 
 	// pseudo-randomizer
-	const TArray<FVector> ActiveGameObjectsCoords = GetActiveGameObjectsPosition();
 	FVector2D Position2;
-	if (!FindGoodSpawnLocation(Position2, ActiveGameObjectsCoords, MinBound, MaxBound))
+	if (!FindGoodSpawnLocationInSafetyField(Position2, MinBound, MaxBound))
 	{
 		GAMEMODE_LOG(Warning, TEXT("Can't find good spawn location for PLAYER. Please report"));
 	}
@@ -1178,36 +1184,71 @@ bool AAccelByteWarsInGameGameMode::FindGoodSpawnLocation(
 	const FVector2D& MaxBound) const
 {
 	AccelByteWars2DProbabilityDistribution spawnGrid(MinBound, MaxBound, 20);
+	ApplySpawnGridBaseline(spawnGrid);
 
-	int numRows = spawnGrid.GetNumRows();
-	int numCols = spawnGrid.GetNumCols();
-	FVector2D cellSize = spawnGrid.GetCellSize();
+	for (const FVector& CircleCoord : ActiveGameObjectsCoords)
+	{
+		spawnGrid.ApplyExclusion(FVector2D(CircleCoord.X, CircleCoord.Y));
+	}
 
-	spawnGrid.IterateGrid([numRows, numCols, cellSize, &spawnGrid](int col, int row, float& value) {
-		FVector2D cellLocation = spawnGrid.GetCellLocation(col, row);
-		value = cellLocation.Length() - cellSize.X * 8.0f;
-		// value = FMath::Min(value, FMath::Abs(cellLocation.X));
-		// value = std::min<float>({ (float)col * (float)cellSize.X * 4.0f, (float)row * (float)cellSize.Y * 4.0f, value });
-		value = FMath::Max(0.0f, value);
-	});
+	return FindGoodPositionInSpawnGrid(spawnGrid, OutCoord);
+}
 
-	for (const FVector& CircleCoord : ActiveGameObjectsCoords)
+bool AAccelByteWarsInGameGameMode::FindGoodSpawnLocationInSafetyField(
+	FVector2D& OutCoord,
+	const FVector2D& MinBound,
+	const FVector2D& MaxBound)
+{
+	FSpawnSafetyField& SafetyField = GetSpawnSafetyField(MinBound, MaxBound);
+
+	// Ships move all the time, so only the objects that reported a move are resplatted, once the field is queried.
+	ResplatMovedSpawnSafetyObjects();
+
+	// Missiles live for a few seconds and are fired far more often than the field is queried,
+	// so they are kept out of the field and only excluded from a copy of it at query time.
+	TArray<FVector2D> MissileLocations;
+	for (const UAccelByteWarsGameplayObjectComponent* ActiveGameObject : ABInGameGameState->ActiveGameObjects)
 	{
-		FVector2D location(CircleCoord.X, CircleCoord.Y);
-		spawnGrid.IterateGrid([&spawnGrid, cellSize, location, radius = CircleCoord.Z](int col, int row, float& value) {
-			FVector2D cellPosition = spawnGrid.GetCellLocation(col, row);
-			float distToCell = FVector2D::Distance(cellPosition, location);
-			distToCell = FMath::Max(0.0f, distToCell);
-			value = FMath::Min(value, distToCell);
-		});
+		if (IsTransientGameplayObject(ActiveGameObject) && ActiveGameObject->GetOwner())
+		{
+			const FVector& ActorLocation = ActiveGameObject->GetOwner()->GetActorLocation();
+			MissileLocations.Add(FVector2D(ActorLocation.X, ActorLocation.Y));
+		}
 	}
 
-	if (spawnGrid.FindGoodPosition(OutCoord, 250.0f))
+	if (MissileLocations.IsEmpty())
+	{
+		return FindGoodPositionInSpawnGrid(SafetyField.Field, OutCoord);
+	}
+
+	AccelByteWars2DProbabilityDistribution SpawnGrid = SafetyField.Field;
+	for (const FVector2D& MissileLocation : MissileLocations)
+	{
+		SpawnGrid.ApplyExclusion(MissileLocation);
+	}
+
+	return FindGoodPositionInSpawnGrid(SpawnGrid, OutCoord);
+}
+
+void AAccelByteWarsInGameGameMode::ApplySpawnGridBaseline(AccelByteWars2DProbabilityDistribution& SpawnGrid) const
+{
+	const FVector2D CellSize = SpawnGrid.GetCellSize();
+
+	SpawnGrid.IterateGrid([CellSize, &SpawnGrid](int32 Col, int32 Row, float& Value) {
+		const FVector2D CellLocation = SpawnGrid.GetCellLocation(Col, Row);
+		Value = CellLocation.Length() - CellSize.X * 8.0f;
+		Value = FMath::Max(0.0f, Value);
+	});
+}
+
+bool AAccelByteWarsInGameGameMode::FindGoodPositionInSpawnGrid(AccelByteWars2DProbabilityDistribution& SpawnGrid, FVector2D& OutCoord)
+{
+	if (SpawnGrid.FindGoodPosition(OutCoord, 250.0f))
 	{
 		return true;
 	}
 
-	if (spawnGrid.FindGoodPosition(OutCoord, 0.0f))
+	if (SpawnGrid.FindGoodPosition(OutCoord, 0.0f))
 	{
 		return true;
 	}
@@ -1291,6 +1332,236 @@ bool AAccelByteWarsInGameGameMode::LocationHasLineOfSightToOtherShip(const FVect
 
 #pragma endregion
 
+#pragma region "Spawn safety field"
+bool AAccelByteWarsInGameGameMode::IsStaticGameplayObject(const UAccelByteWarsGameplayObjectComponent* Object)
+{
+	return Object && (Object->ObjectType == EGameplayObjectType::PLANET || Object->ObjectType == EGameplayObjectType::STAR);
+}
+
+bool AAccelByteWarsInGameGameMode::IsTransientGameplayObject(const UAccelByteWarsGameplayObjectComponent* Object)
+{
+	return Object && Object->ObjectType == EGameplayObjectType::MISSILE;
+}
+
+AAccelByteWarsInGameGameMode::FSpawnSafetyField& AAccelByteWarsInGameGameMode::GetSpawnSafetyField(
+	const FVector2D& MinBound,
+	const FVector2D& MaxBound)
+{
+	FSpawnSafetyField* SafetyField = SpawnSafetyFields.FindByPredicate([&MinBound, &MaxBound](const FSpawnSafetyField& Temp)
+	{
+		return Temp.MinBound.Equals(MinBound) && Temp.MaxBound.Equals(MaxBound);
+	});
+	if (!SafetyField)
+	{
+		SafetyField = &SpawnSafetyFields.Emplace_GetRef(MinBound, MaxBound);
+
+		const float FieldTolerance = SafetyField->Field.GetCellSize().GetMin() * 0.5f;
+		SpawnSafetyMoveTolerance = SpawnSafetyFields.Num() == 1 ? FieldTolerance : FMath::Min(SpawnSafetyMoveTolerance, FieldTolerance);
+
+		// Moves are not tracked while there is no field, so catch up with the current locations before the first bake.
+		if (SpawnSafetyFields.Num() == 1)
+		{
+			for (TPair<int32, FSpawnSafetyObject>& Object : SpawnSafetyObjects)
+			{
+				if (const USceneComponent* RootComponent = Object.Value.RootComponent.Get())
+				{
+					const FVector& ComponentLocation = RootComponent->GetComponentLocation();
+					Object.Value.Location = FVector2D(ComponentLocation.X, ComponentLocation.Y);
+				}
+			}
+			MovedSpawnSafetyObjectIds.Reset();
+		}
+	}
+
+	// Rebake the field only if the planets or stars changed.
+	if (SafetyField->StaticVersion != SpawnSafetyStaticVersion)
+	{
+		RebuildSpawnSafetyField(*SafetyField);
+	}
+	return *SafetyField;
+}
+
+void AAccelByteWarsInGameGameMode::RebuildSpawnSafetyField(FSpawnSafetyField& SafetyField) const
+{
+	ApplySpawnGridBaseline(SafetyField.StaticField);
+	for (const UAccelByteWarsGameplayObjectComponent* ActiveGameObject : ABInGameGameState->ActiveGameObjects)
+	{
+		if (IsStaticGameplayObject(ActiveGameObject) && ActiveGameObject->GetOwner())
+		{
+			const FVector& ActorLocation = ActiveGameObject->GetOwner()->GetActorLocation();
+			SafetyField.StaticField.ApplyExclusion(FVector2D(ActorLocation.X, ActorLocation.Y));
+		}
+	}
+
+	SafetyField.Field = SafetyField.StaticField;
+	SafetyField.CellOwners.Init(INDEX_NONE, SafetyField.Field.GetNumCells());
+	for (const TPair<int32, FSpawnSafetyObject>& Object : SpawnSafetyObjects)
+	{
+		SplatSpawnSafetyObjectCells(SafetyField, Object.Key, Object.Value.Location);
+	}
+
+	SafetyField.StaticVersion = SpawnSafetyStaticVersion;
+}
+
+void AAccelByteWarsInGameGameMode::SplatSpawnSafetyObject(const UAccelByteWarsGameplayObjectComponent* Object)
+{
+	if (!Object || !Object->GetOwner() || !Object->GetOwner()->GetRootComponent())
+	{
+		return;
+	}
+
+	if (IsStaticGameplayObject(Object))
+	{
+		SpawnSafetyStaticVersion++;
+		return;
+	}
+
+	if (IsTransientGameplayObject(Object) || SpawnSafetyObjectIds.Contains(Object))
+	{
+		return;
+	}
+
+	USceneComponent* RootComponent = Object->GetOwner()->GetRootComponent();
+	const FVector& ComponentLocation = RootComponent->GetComponentLocation();
+	const int32 ObjectId = NextSpawnSafetyObjectId++;
+
+	FSpawnSafetyObject& SafetyObject = SpawnSafetyObjects.Add(ObjectId);
+	SafetyObject.RootComponent = RootComponent;
+	SafetyObject.Location = FVector2D(ComponentLocation.X, ComponentLocation.Y);
+	SafetyObject.TransformUpdatedHandle = RootComponent->TransformUpdated.AddUObject(this, &ThisClass::OnSpawnSafetyObjectMoved, ObjectId);
+	SpawnSafetyObjectIds.Add(Object, ObjectId);
+
+	for (FSpawnSafetyField& SafetyField : SpawnSafetyFields)
+	{
+		if (SafetyField.StaticVersion == SpawnSafetyStaticVersion)
+		{
+			SplatSpawnSafetyObjectCells(SafetyField, ObjectId, SafetyObject.Location);
+		}
+	}
+}
+
+void AAccelByteWarsInGameGameMode::UnsplatSpawnSafetyObject(const UAccelByteWarsGameplayObjectComponent* Object)
+{
+	if (IsStaticGameplayObject(Object))
+	{
+		SpawnSafetyStaticVersion++;
+		return;
+	}
+
+	int32 ObjectId = INDEX_NONE;
+	if (!SpawnSafetyObjectIds.RemoveAndCopyValue(Object, ObjectId))
+	{
+		return;
+	}
+
+	FSpawnSafetyObject SafetyObject;
+	if (SpawnSafetyObjects.RemoveAndCopyValue(ObjectId, SafetyObject) && SafetyObject.RootComponent.IsValid())
+	{
+		SafetyObject.RootComponent->TransformUpdated.Remove(SafetyObject.TransformUpdatedHandle);
+	}
+	MovedSpawnSafetyObjectIds.Remove(ObjectId);
+
+	for (FSpawnSafetyField& SafetyField : SpawnSafetyFields)
+	{
+		if (SafetyField.StaticVersion == SpawnSafetyStaticVersion)
+		{
+			UnsplatSpawnSafetyObjectCells(SafetyField, ObjectId);
+		}
+	}
+}
+
+void AAccelByteWarsInGameGameMode::SplatSpawnSafetyObjectCells(FSpawnSafetyField& SafetyField, const int32 ObjectId, const FVector2D& Location) const
+{
+	for (int32 CellIndex = 0; CellIndex < SafetyField.CellOwners.Num(); CellIndex++)
+	{
+		const float Value = SafetyField.Field.GetExclusionValue(CellIndex, Location);
+		if (Value < SafetyField.Field.GetCellValue(CellIndex))
+		{
+			SafetyField.Field.SetCellValue(CellIndex, Value);
+			SafetyField.CellOwners[CellIndex] = ObjectId;
+		}
+	}
+}
+
+void AAccelByteWarsInGameGameMode::UnsplatSpawnSafetyObjectCells(FSpawnSafetyField& SafetyField, const int32 ObjectId) const
+{
+	for (int32 CellIndex = 0; CellIndex < SafetyField.CellOwners.Num(); CellIndex++)
+	{
+		if (SafetyField.CellOwners[CellIndex] != ObjectId)
+		{
+			continue;
+		}
+
+		// Fall back to the static layer, then let the nearest remaining object claim the cell.
+		float Value = SafetyField.StaticField.GetCellValue(CellIndex);
+		int32 Owner = INDEX_NONE;
+		for (const TPair<int32, FSpawnSafetyObject>& Other : SpawnSafetyObjects)
+		{
+			if (Other.Key == ObjectId)
+			{
+				continue;
+			}
+
+			const float OtherValue = SafetyField.Field.GetExclusionValue(CellIndex, Other.Value.Location);
+			if (OtherValue < Value)
+			{
+				Value = OtherValue;
+				Owner = Other.Key;
+			}
+		}
+
+		SafetyField.Field.SetCellValue(CellIndex, Value);
+		SafetyField.CellOwners[CellIndex] = Owner;
+	}
+}
+
+void AAccelByteWarsInGameGameMode::OnSpawnSafetyObjectMoved(
+	USceneComponent* UpdatedComponent,
+	EUpdateTransformFlags UpdateTransformFlags,
+	ETeleportType Teleport,
+	const int32 ObjectId)
+{
+	if (!UpdatedComponent || SpawnSafetyFields.IsEmpty())
+	{
+		return;
+	}
+
+	// Only record the move here, it is called on every transform update.
+	const FSpawnSafetyObject* SafetyObject = SpawnSafetyObjects.Find(ObjectId);
+	const FVector& ComponentLocation = UpdatedComponent->GetComponentLocation();
+	if (SafetyObject && FVector2D::DistSquared(FVector2D(ComponentLocation.X, ComponentLocation.Y), SafetyObject->Location) > FMath::Square(SpawnSafetyMoveTolerance))
+	{
+		MovedSpawnSafetyObjectIds.Add(ObjectId);
+	}
+}
+
+void AAccelByteWarsInGameGameMode::ResplatMovedSpawnSafetyObjects()
+{
+	for (const int32 ObjectId : MovedSpawnSafetyObjectIds)
+	{
+		FSpawnSafetyObject* SafetyObject = SpawnSafetyObjects.Find(ObjectId);
+		if (!SafetyObject || !SafetyObject->RootComponent.IsValid())
+		{
+			continue;
+		}
+
+		const FVector& ComponentLocation = SafetyObject->RootComponent->GetComponentLocation();
+		SafetyObject->Location = FVector2D(ComponentLocation.X, ComponentLocation.Y);
+
+		for (FSpawnSafetyField& SafetyField : SpawnSafetyFields)
+		{
+			if (SafetyField.StaticVersion == SpawnSafetyStaticVersion)
+			{
+				UnsplatSpawnSafetyObjectCells(SafetyField, ObjectId);
+				SplatSpawnSafetyObjectCells(SafetyField, ObjectId, SafetyObject->Location);
+			}
+		}
+	}
+
+	MovedSpawnSafetyObjectIds.Reset();
+}
+#pragma endregion
+
 #pragma region "Debugging"
 void AAccelByteWarsInGameGameMode::StartPlanetSpawningTimer(float InRate)
 {
@@ -9,6 +9,7 @@
 #include "Core/GameModes/AccelByteWarsGameMode.h"
 #include "Core/GameStates/AccelByteWarsInGameGameState.h"
 #include "Core/Player/AccelByteWarsPlayerPawn.h"
+#include "Core/Utilities/AccelByteWars2DProbabilityDistribution.h"
 #include "Engine/SCS_Node.h"
 #include "AccelByteWarsInGameGameMode.generated.h"
 
@@ -119,10 +120,11 @@ public:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void Tick(float DeltaSeconds) override;
-	virtual void PostLogin(APlayerController* NewPlayer) override;
 	virtual void Logout(AController* Exiting) override;
 	//~End of AGameModeBase overridden functions
 
+	virtual void OnPostLoginTeamSetupDone(APlayerController* PlayerController) override;
+
 	UPROPERTY(BlueprintReadOnly, EditAnywhere)
 	TSubclassOf<AAccelByteWarsPlayerPawn> PawnClass;
 
@@ -206,7 +208,7 @@ protected:
 
 #pragma region "Gameplay logic"
 public:
-	void SetupGameplayObject(AActor* Object) const;
+	void SetupGameplayObject(AActor* Object);
 
 private:
 	void StartGame();
@@ -227,7 +229,7 @@ private:
 	bool FindGoodPlanetPosition(FVector& Position) const;
 
 	// #jog afif Need to replace team id with player id
-	FVector FindGoodPlayerPosition(APlayerState* PlayerState) const;
+	FVector FindGoodPlayerPosition(APlayerState* PlayerState);
 
 protected:
 	UFUNCTION()
@@ -261,12 +263,101 @@ private:
 		const FVector2D& MinBound,
 		const FVector2D& MaxBound) const;
 
+	/**
+	 * @brief Same as FindGoodSpawnLocation, but samples the spawn safety field of the area instead of building a new grid
+	 * @param OutCoord Calculated coord
+	 * @param MinBound Spawn area min bound
+	 * @param MaxBound Spawn area max bound
+	 * @return true if good location found, false if area is too cramped
+	 */
+	bool FindGoodSpawnLocationInSafetyField(
+		FVector2D& OutCoord,
+		const FVector2D& MinBound,
+		const FVector2D& MaxBound);
+
+	void ApplySpawnGridBaseline(AccelByteWars2DProbabilityDistribution& SpawnGrid) const;
+	static bool FindGoodPositionInSpawnGrid(AccelByteWars2DProbabilityDistribution& SpawnGrid, FVector2D& OutCoord);
+
 	bool IsInsideCircle(const FVector2D& Target, const FVector& Circle) const;
 	double CalculateCircleLengthAlongXonY(const FVector& Circle, const double Ycoord) const;
 	FVector2D CalculateActualCoord(const double RelativeLocation, const FVector2D& MinBound, const double RangeX) const;
 	bool LocationHasLineOfSightToOtherShip(const FVector& PositionToTest) const;
 #pragma endregion
 
+#pragma region "Spawn safety field"
+private:
+	/**
+	 * @brief Spawn grid of a spawn area that is kept and updated for the whole match.
+	 * StaticField holds the area baseline and the exclusions of the planets and stars, it is only rebaked when they change.
+	 * Field is StaticField plus the exclusions of the other gameplay objects at their last splatted locations, except missiles.
+	 * CellOwners holds the id of the object that gives each cell of Field its value, INDEX_NONE if it is StaticField.
+	 */
+	struct FSpawnSafetyField
+	{
+		FSpawnSafetyField(const FVector2D& InMinBound, const FVector2D& InMaxBound)
+			: MinBound(InMinBound), MaxBound(InMaxBound), StaticField(InMinBound, InMaxBound, 20), Field(StaticField) {}
+
+		FVector2D MinBound;
+		FVector2D MaxBound;
+		AccelByteWars2DProbabilityDistribution StaticField;
+		AccelByteWars2DProbabilityDistribution Field;
+		TArray<int32> CellOwners;
+		int32 StaticVersion = INDEX_NONE;
+	};
+
+	struct FSpawnSafetyObject
+	{
+		TWeakObjectPtr<USceneComponent> RootComponent;
+		FDelegateHandle TransformUpdatedHandle;
+		FVector2D Location;
+	};
+
+	static bool IsStaticGameplayObject(const UAccelByteWarsGameplayObjectComponent* Object);
+
+	/**
+	 * @brief Short-lived objects that are not kept in the fields, they are excluded when a field is queried instead
+	 */
+	static bool IsTransientGameplayObject(const UAccelByteWarsGameplayObjectComponent* Object);
+
+	/**
+	 * @brief Get the up to date spawn safety field of the spawn area, creating it on first use
+	 */
+	FSpawnSafetyField& GetSpawnSafetyField(const FVector2D& MinBound, const FVector2D& MaxBound);
+	void RebuildSpawnSafetyField(FSpawnSafetyField& SafetyField) const;
+
+	void SplatSpawnSafetyObject(const UAccelByteWarsGameplayObjectComponent* Object);
+	void UnsplatSpawnSafetyObject(const UAccelByteWarsGameplayObjectComponent* Object);
+
+	/**
+	 * @brief Lower the cells of the field that are closer to the object than to anything else
+	 */
+	void SplatSpawnSafetyObjectCells(FSpawnSafetyField& SafetyField, const int32 ObjectId, const FVector2D& Location) const;
+
+	/**
+	 * @brief Recompute the cells of the field the object gives its value to, from the static layer and the other objects
+	 */
+	void UnsplatSpawnSafetyObjectCells(FSpawnSafetyField& SafetyField, const int32 ObjectId) const;
+
+	void OnSpawnSafetyObjectMoved(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport, const int32 ObjectId);
+
+	/**
+	 * @brief Resplat the gameplay objects that reported a move of more than half a grid cell since they were splatted
+	 */
+	void ResplatMovedSpawnSafetyObjects();
+
+	TArray<FSpawnSafetyField> SpawnSafetyFields;
+	TMap<int32, FSpawnSafetyObject> SpawnSafetyObjects;
+	TMap<TWeakObjectPtr<const UAccelByteWarsGameplayObjectComponent>, int32> SpawnSafetyObjectIds;
+	TSet<int32> MovedSpawnSafetyObjectIds;
+	int32 NextSpawnSafetyObjectId = 0;
+
+	// Half of the smallest grid cell of the fields, smaller moves are not worth a resplat.
+	float SpawnSafetyMoveTolerance = 0.0f;
+
+	// Incremented whenever the planets or stars change, fields with an older version are rebuilt on query.
+	int32 SpawnSafetyStaticVersion = 0;
+#pragma endregion
+
 #pragma region "Debugging"
 	UFUNCTION(Exec)
 	void StartPlanetSpawningTimer(float InRate);
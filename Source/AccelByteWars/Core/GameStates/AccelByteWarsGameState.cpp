@@ -93,12 +93,20 @@ void AAccelByteWarsGameState::OnNotify_GameSetup() const
 
 void AAccelByteWarsGameState::OnNotify_Teams()
 {
+	// Notify once the Teams update is done.
+	if (TeamsUpdateDepth > 0)
+	{
+		bHasPendingTeamsNotify = true;
+		return;
+	}
+
 	OnTeamsChanged.Broadcast();
 }
 
 void AAccelByteWarsGameState::EmptyTeams()
 {
 	Teams.Empty();
+	InvalidateTeamsLookup();
 	if (HasAuthority())
 	{
 		OnNotify_Teams();
@@ -371,6 +379,27 @@ FGameplayPlayerData* AAccelByteWarsGameState::GetPlayerDataById(
 	const FUniqueNetIdRepl UniqueNetId,
 	const int32 ControllerId)
 {
+	if (TeamsUpdateDepth > 0)
+	{
+		BuildTeamsLookup();
+
+		// Pick the first match in Teams order, same as the linear search below.
+		FIntPoint Location(INDEX_NONE, INDEX_NONE);
+		if (const FIntPoint* UniqueNetIdLocation = UniqueNetId.IsValid() ? TeamsLookup.UniqueNetIds.Find(UniqueNetId) : nullptr)
+		{
+			Location = *UniqueNetIdLocation;
+		}
+		if (const FIntPoint* ControllerIdLocation = TeamsLookup.ControllerIds.Find(ControllerId))
+		{
+			if (Location.X == INDEX_NONE || IsBeforeInTeams(*ControllerIdLocation, Location))
+			{
+				Location = *ControllerIdLocation;
+			}
+		}
+
+		return Location.X == INDEX_NONE ? nullptr : &Teams[Location.X].TeamMembers[Location.Y];
+	}
+
 	FGameplayPlayerData* PlayerData = nullptr;
 	for (FGameplayTeamData& Team : Teams)
 	{
@@ -385,6 +414,12 @@ FGameplayPlayerData* AAccelByteWarsGameState::GetPlayerDataById(
 
 int32 AAccelByteWarsGameState::GetRegisteredPlayersNum() const
 {
+	if (TeamsUpdateDepth > 0)
+	{
+		BuildTeamsLookup();
+		return TeamsLookup.RegisteredPlayersNum;
+	}
+
 	int32 Num = 0;
 	for (const FGameplayTeamData& Team : Teams)
 	{
@@ -421,18 +456,20 @@ bool AAccelByteWarsGameState::AddPlayerToTeam(
 
 	// Check if target team ID exist or not. If yes, add player to that team. If not, create a new team then add player to that team.
 	FGameplayTeamData* TargetTeam = nullptr;
+	int32 TargetTeamIndex = INDEX_NONE;
 	for (int i = 0; i < Teams.Num(); ++i)
 	{
 		if (Teams[i].TeamId == TeamId)
 		{
 			TargetTeam = &Teams[i];
+			TargetTeamIndex = i;
 			break;
 		}
 	}
 	if (!TargetTeam)
 	{
-		const int32 AddedTeamIndex = Teams.Add(FGameplayTeamData{TeamId});
-		TargetTeam = &Teams[AddedTeamIndex];
+		TargetTeamIndex = Teams.Add(FGameplayTeamData{TeamId});
+		TargetTeam = &Teams[TargetTeamIndex];
 		if (HasAuthority())
 		{
 			OnNotify_Teams();
@@ -479,7 +516,12 @@ bool AAccelByteWarsGameState::AddPlayerToTeam(
 		OutLives
 	};
 	PlayerData.bIsBot = bIsBot;
-	TargetTeam->TeamMembers.Add(PlayerData);
+	const int32 MemberIndex = TargetTeam->TeamMembers.Add(PlayerData);
+
+	if (TeamsLookup.bIsValid)
+	{
+		AddToTeamsLookup(PlayerData, FIntPoint(TargetTeamIndex, MemberIndex));
+	}
 
 	if (HasAuthority())
 	{
@@ -497,6 +539,7 @@ bool AAccelByteWarsGameState::RemovePlayerFromTeam(const FUniqueNetIdRepl Unique
 		{
 			if (Team.TeamMembers.Remove(FGameplayPlayerData{UniqueNetId, ControllerId}) > 0)
 			{
+				InvalidateTeamsLookup();
 				if (HasAuthority())
 				{
 					OnNotify_Teams();
@@ -525,6 +568,73 @@ void AAccelByteWarsGameState::RemoveEmptyTeam()
 	{
 		Teams.Remove(ToRemove);
 	}
+	InvalidateTeamsLookup();
+}
+
+void AAccelByteWarsGameState::BeginTeamsUpdate()
+{
+	TeamsUpdateDepth++;
+}
+
+void AAccelByteWarsGameState::EndTeamsUpdate()
+{
+	if (!ensure(TeamsUpdateDepth > 0))
+	{
+		return;
+	}
+
+	if (--TeamsUpdateDepth > 0)
+	{
+		return;
+	}
+
+	// The index is not maintained outside of an update.
+	TeamsLookup = FTeamsLookup();
+
+	if (bHasPendingTeamsNotify)
+	{
+		bHasPendingTeamsNotify = false;
+		OnNotify_Teams();
+	}
+}
+
+void AAccelByteWarsGameState::InvalidateTeamsLookup() const
+{
+	TeamsLookup.bIsValid = false;
+}
+
+void AAccelByteWarsGameState::BuildTeamsLookup() const
+{
+	if (TeamsLookup.bIsValid)
+	{
+		return;
+	}
+
+	TeamsLookup = FTeamsLookup();
+	TeamsLookup.bIsValid = true;
+
+	for (int32 TeamIndex = 0; TeamIndex < Teams.Num(); ++TeamIndex)
+	{
+		const TArray<FGameplayPlayerData>& TeamMembers = Teams[TeamIndex].TeamMembers;
+		for (int32 MemberIndex = 0; MemberIndex < TeamMembers.Num(); ++MemberIndex)
+		{
+			AddToTeamsLookup(TeamMembers[MemberIndex], FIntPoint(TeamIndex, MemberIndex));
+		}
+	}
+}
+
+void AAccelByteWarsGameState::AddToTeamsLookup(const FGameplayPlayerData& PlayerData, const FIntPoint& Location) const
+{
+	// Keep the first location in Teams order only, lookups return the first match like a linear search does.
+	FIntPoint& StoredLocation = PlayerData.UniqueNetId.IsValid() ?
+		TeamsLookup.UniqueNetIds.FindOrAdd(PlayerData.UniqueNetId, Location) :
+		TeamsLookup.ControllerIds.FindOrAdd(PlayerData.ControllerId, Location);
+	if (IsBeforeInTeams(Location, StoredLocation))
+	{
+		StoredLocation = Location;
+	}
+
+	TeamsLookup.RegisteredPlayersNum++;
 }
 
 void AAccelByteWarsGameState::InitializeGUICheatWidgetEntries()
@@ -24,6 +24,7 @@ ACCELBYTEWARS_API DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteWarsGameState, Log, Al
 #pragma region "Structs, Enums, and Delegates declaration"
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FGameStateVoidDelegate);
 DECLARE_DELEGATE_RetVal_OneParam(const FString, FOnSetDefaultDisplayNameDelegate, const FUniqueNetId& /*UserId*/)
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnPlayerGameplayEffectsChanged, APlayerState* /*PlayerState*/)
 #pragma endregion 
 
 UCLASS()
@@ -61,6 +62,9 @@ public:
 	FSimpleMulticastDelegate OnTeamsChanged;
 	FSimpleMulticastDelegate OnPowerUpChanged;
 
+	// Called when the HUD gameplay effects of a single player changed.
+	FOnPlayerGameplayEffectsChanged OnPlayerGameplayEffectsChanged;
+
 	// Static delegate to be called when the game state is initialized and replicated.
 	inline static FSimpleMulticastDelegate OnInitialized;
 
@@ -197,6 +201,19 @@ public:
 	 * @brief Remove team that doesn't have registered member
 	 */
 	void RemoveEmptyTeam();
+
+	/**
+	 * @brief Start a batch of Teams changes, e.g. the team setup of a burst of joining players.
+	 * Until the matching EndTeamsUpdate, player lookups and the registered players count are served from an index,
+	 * and OnNotify_Teams is held back to be called once at the end. Calls can be nested.
+	 */
+	void BeginTeamsUpdate();
+	void EndTeamsUpdate();
+
+	/**
+	 * @brief Rebuild the player lookup index on next use, call this after modifying a player's ids directly in Teams
+	 */
+	void InvalidateTeamsLookup() const;
 	
 	// Countdown to close the server after the game ends.
 	UPROPERTY(Replicated)
@@ -223,6 +240,29 @@ private:
 	UPROPERTY(EditAnywhere)
 	bool bAutoRestoreData = true;
 
+	/**
+	 * @brief Location of the players in Teams, only kept during a Teams update.
+	 * Mirrors FGameplayPlayerData::operator==: players with a valid unique net id are matched by it, the others by controller id.
+	 */
+	struct FTeamsLookup
+	{
+		TMap<FUniqueNetIdRepl, FIntPoint> UniqueNetIds;
+		TMap<int32, FIntPoint> ControllerIds;
+		int32 RegisteredPlayersNum = 0;
+		bool bIsValid = false;
+	};
+
+	void BuildTeamsLookup() const;
+	void AddToTeamsLookup(const FGameplayPlayerData& PlayerData, const FIntPoint& Location) const;
+	static bool IsBeforeInTeams(const FIntPoint& Location, const FIntPoint& Other)
+	{
+		return Location.X < Other.X || (Location.X == Other.X && Location.Y < Other.Y);
+	}
+
+	mutable FTeamsLookup TeamsLookup;
+	int32 TeamsUpdateDepth = 0;
+	bool bHasPendingTeamsNotify = false;
+
 #pragma region "GUI Cheat"
 public:
 	UPROPERTY()
@@ -23,6 +23,7 @@ void AAccelByteWarsInGameGameState::GetLifetimeReplicatedProps(TArray<FLifetimeP
 	DOREPLIFETIME(ThisClass, MinStarsGameBound);
 	DOREPLIFETIME(ThisClass, MaxStarsGameBound);
 	DOREPLIFETIME(ThisClass, GameBoundExtendMultiplier);
+	DOREPLIFETIME(ThisClass, ServerTickTier);
 }
 
 void AAccelByteWarsInGameGameState::BeginPlay()
@@ -124,9 +125,3 @@ void AAccelByteWarsInGameGameState::MulticastOnPlayerDie_Implementation(const AA
 {
 	OnPlayerDieDelegate.Broadcast(DeathPlayer, DeathLocation, Killer);
 }
-
-void AAccelByteWarsInGameGameState::MulticastRefreshHUDGameplayEffects_Implementation()
-{
-    // Broadcast locally so UI listening to OnTeamsChanged refreshes effect entries
-    OnNotify_Teams();
-}
\ No newline at end of file
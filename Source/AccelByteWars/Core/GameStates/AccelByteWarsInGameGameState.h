@@ -27,6 +27,15 @@ enum class EGameStatus : uint8
 	GAME_ENDS,
 	INVALID
 };
+
+// Simulation fidelity the dedicated server currently runs the gameplay actors at, lowered when the server is overloaded.
+UENUM(BlueprintType)
+enum class EServerTickTier : uint8
+{
+	FULL = 0,
+	REDUCED,
+	MINIMAL
+};
 #pragma endregion 
 
 UCLASS()
@@ -50,10 +59,6 @@ public:
 	UFUNCTION(NetMulticast, Reliable)
 	void MulticastOnPlayerDie(const AAccelByteWarsPlayerState* DeathPlayer, const FVector DeathLocation, const AAccelByteWarsPlayerState* Killer);
 
-    // Notify all clients to refresh HUD gameplay effect widgets
-    UFUNCTION(NetMulticast, Unreliable)
-    void MulticastRefreshHUDGameplayEffects();
-
 	/**
 	 * @brief Current gameplay state
 	 */
@@ -97,6 +102,12 @@ public:
 	UPROPERTY(Replicated, BlueprintReadWrite)
 	TArray<UAccelByteWarsGameplayObjectComponent*> ActiveGameObjects;
 
+	/**
+	 * @brief Current tier of the server tick governor, always FULL when not running on a dedicated server
+	 */
+	UPROPERTY(BlueprintReadOnly, Replicated)
+	EServerTickTier ServerTickTier = EServerTickTier::FULL;
+
 	static inline FOnPlayerDieDelegate OnPlayerDieDelegate;
 
 protected:
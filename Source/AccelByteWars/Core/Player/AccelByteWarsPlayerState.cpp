@@ -16,6 +16,8 @@
 #include "AbilitySystemComponent.h"
 #include "Net/UnrealNetwork.h"
 
+static_assert(EQUIPPED_ITEM_SLOT_NUM == static_cast<int32>(EItemType::MissileTrailFx) + 1, "Equipped item slots must match the EItemType values");
+
 AAccelByteWarsPlayerState::AAccelByteWarsPlayerState()
 {
 	// Create GAS components
@@ -70,7 +72,8 @@ void AAccelByteWarsPlayerState::GetLifetimeReplicatedProps(TArray<FLifetimePrope
 	DOREPLIFETIME(AAccelByteWarsPlayerState, NumLivesLeft);
 	DOREPLIFETIME(AAccelByteWarsPlayerState, bPendingTeamAssignment);
 	DOREPLIFETIME(AAccelByteWarsPlayerState, NumKilledAttemptInSingleLifetime);
-	DOREPLIFETIME(AAccelByteWarsPlayerState, EquippedItems);
+	DOREPLIFETIME(AAccelByteWarsPlayerState, EquippedItemSlots);
+	DOREPLIFETIME(AAccelByteWarsPlayerState, GameplayEffectsHUDState);
 }
 
 void AAccelByteWarsPlayerState::RepNotify_PendingTeamAssignment()
@@ -89,37 +92,58 @@ void AAccelByteWarsPlayerState::RepNotify_EquippedItemsChanged()
 	NotifyGameState();
 }
 
-FString AAccelByteWarsPlayerState::GetEquippedItemId(const EItemType ItemType, const bool bForce)
+void AAccelByteWarsPlayerState::RepNotify_GameplayEffectsHUDState()
 {
-	return GetEquippedItem(ItemType, bForce).ItemId;
+	if (const AAccelByteWarsGameState* GameState = GetWorld()->GetGameState<AAccelByteWarsGameState>())
+	{
+		GameState->OnPlayerGameplayEffectsChanged.Broadcast(this);
+	}
 }
 
-FEquippedItem AAccelByteWarsPlayerState::GetEquippedItem(const EItemType ItemType, const bool bForce)
+FString AAccelByteWarsPlayerState::GetEquippedItemId(const EItemType ItemType, const bool bForce) const
 {
-	for (const FEquippedItem& EquippedItem : EquippedItems)
+	const FEquippedItem* EquippedItem = GetEquippedItemSlot(ItemType);
+	if (EquippedItem && EquippedItem->ItemType == ItemType && (bForce || EquippedItem->Count > 0))
 	{
-		if (EquippedItem.ItemType == ItemType)
-		{
-			if (bForce || EquippedItem.Count > 0)
-			{
-				return EquippedItem;
-			}
-		}
+		return EquippedItem->ItemId;
+	}
+
+	return FString();
+}
+
+FEquippedItem AAccelByteWarsPlayerState::GetEquippedItem(const EItemType ItemType, const bool bForce) const
+{
+	const FEquippedItem* EquippedItem = GetEquippedItemSlot(ItemType);
+	if (EquippedItem && EquippedItem->ItemType == ItemType && (bForce || EquippedItem->Count > 0))
+	{
+		return *EquippedItem;
 	}
 
 	return FEquippedItem();
 }
 
+FEquippedItem* AAccelByteWarsPlayerState::GetEquippedItemSlot(const EItemType ItemType)
+{
+	const int32 SlotIndex = static_cast<int32>(ItemType);
+	return (ItemType != EItemType::None && SlotIndex < EQUIPPED_ITEM_SLOT_NUM) ? &EquippedItemSlots[SlotIndex] : nullptr;
+}
+
+const FEquippedItem* AAccelByteWarsPlayerState::GetEquippedItemSlot(const EItemType ItemType) const
+{
+	return const_cast<AAccelByteWarsPlayerState*>(this)->GetEquippedItemSlot(ItemType);
+}
+
 void AAccelByteWarsPlayerState::DecreaseEquippedItemCount(const EItemType ItemType, int32 DecreaseBy)
 {
-	for (FEquippedItem& EquippedItem : EquippedItems)
+	// Only the count of this slot changes, so only that value is replicated.
+	FEquippedItem* EquippedItem = GetEquippedItemSlot(ItemType);
+	if (!EquippedItem || EquippedItem->ItemType != ItemType)
 	{
-		if (EquippedItem.ItemType == ItemType)
-		{
-			EquippedItem.Count -= DecreaseBy;
-		}
+		return;
 	}
 
+	EquippedItem->Count -= DecreaseBy;
+
 	if (!IsRunningDedicatedServer())
 	{
 		NotifyGameState();
@@ -173,20 +197,49 @@ void AAccelByteWarsPlayerState::ServerUpdateEquippedItems_Implementation(const T
 		return;
 	}
 
-	EquippedItems.Empty();
+	// If several items share a type, keep the first one that is still usable, or the first one if none is.
+	FEquippedItem NewEquippedItemSlots[EQUIPPED_ITEM_SLOT_NUM];
+	bool bIsSlotFilled[EQUIPPED_ITEM_SLOT_NUM] = {};
 	for (const FEquippedItem& Item : Items)
 	{
 		if (const UInGameItemDataAsset* InGameItemDataAsset = UInGameItemUtility::GetItemDataAsset(Item.ItemId))
 		{
-			EquippedItems.Add({ InGameItemDataAsset->Type, InGameItemDataAsset->Id, Item.Count });
+			const int32 SlotIndex = static_cast<int32>(InGameItemDataAsset->Type);
+			if (InGameItemDataAsset->Type == EItemType::None || SlotIndex >= EQUIPPED_ITEM_SLOT_NUM)
+			{
+				continue;
+			}
+
+			if (bIsSlotFilled[SlotIndex] && (NewEquippedItemSlots[SlotIndex].Count > 0 || Item.Count <= 0))
+			{
+				continue;
+			}
+
+			NewEquippedItemSlots[SlotIndex] = { InGameItemDataAsset->Type, InGameItemDataAsset->Id, Item.Count };
+			bIsSlotFilled[SlotIndex] = true;
 		}
 	}
 
+	// Only touch the slots that changed, the others are not replicated again.
+	bool bEquippedItemsChanged = false;
+	for (int32 SlotIndex = 0; SlotIndex < EQUIPPED_ITEM_SLOT_NUM; SlotIndex++)
+	{
+		FEquippedItem& EquippedItem = EquippedItemSlots[SlotIndex];
+		const FEquippedItem& NewEquippedItem = NewEquippedItemSlots[SlotIndex];
+		if (EquippedItem == NewEquippedItem && EquippedItem.Count == NewEquippedItem.Count)
+		{
+			continue;
+		}
+
+		EquippedItem = NewEquippedItem;
+		bEquippedItemsChanged = true;
+	}
+
 	// Give modules a chance to verify items
 	OnEquippedItemsLoadedDelegate.Broadcast(this);
 
 	// If this is a P2P host, trigger manually
-	if (!IsRunningDedicatedServer())
+	if (bEquippedItemsChanged && !IsRunningDedicatedServer())
 	{
 		RepNotify_EquippedItemsChanged();
 	}
@@ -229,33 +282,65 @@ void AAccelByteWarsPlayerState::OnGameplayEffectApplied(UAbilitySystemComponent*
 			ABGameMode->AddPlayerScore(this, 100, false);
 		}
 	}
-
-	// Always notify team changes for all gameplay effects (for HUD updates)
-	if (AAccelByteWarsInGameGameState* ABInGameGameState = Cast<AAccelByteWarsInGameGameState>(UGameplayStatics::GetGameState(this)))
-	{
-		ABInGameGameState->OnNotify_Teams();
-	}
 }
 
 void AAccelByteWarsPlayerState::OnActiveGameplayEffectAdded(UAbilitySystemComponent* ASC, const FGameplayEffectSpec& EffectSpec, FActiveGameplayEffectHandle EffectHandle)
 {
 	if (HasAuthority() && ASC)
 	{
-		if (AAccelByteWarsInGameGameState* GameState = Cast<AAccelByteWarsInGameGameState>(UGameplayStatics::GetGameState(this)))
-		{
-			GameState->MulticastRefreshHUDGameplayEffects();
-		}
+		UpdateGameplayEffectsHUDState();
 	}
 }
 
 void AAccelByteWarsPlayerState::OnActiveGameplayEffectRemoved(const FActiveGameplayEffect& RemovedEffect)
 {
-	// Execute GameplayCue to notify all clients about HUD changes
 	if (HasAuthority() && AbilitySystemComponent)
 	{
-		if (AAccelByteWarsInGameGameState* GameState = Cast<AAccelByteWarsInGameGameState>(UGameplayStatics::GetGameState(this)))
+		UpdateGameplayEffectsHUDState(RemovedEffect.Handle);
+	}
+}
+
+void AAccelByteWarsPlayerState::UpdateGameplayEffectsHUDState(const FActiveGameplayEffectHandle& RemovedEffectHandle)
+{
+	if (!HasAuthority() || !AbilitySystemComponent)
+	{
+		return;
+	}
+
+	// Same effects the HUD shows: active effects with duration.
+	FGameplayEffectsHUDState NewState;
+	int32 NumEffects = 0;
+	for (const FActiveGameplayEffectHandle& EffectHandle : AbilitySystemComponent->GetActiveEffects(FGameplayEffectQuery()))
+	{
+		if (EffectHandle == RemovedEffectHandle)
+		{
+			continue;
+		}
+
+		const FActiveGameplayEffect* ActiveEffect = AbilitySystemComponent->GetActiveGameplayEffect(EffectHandle);
+		if (!ActiveEffect || ActiveEffect->IsPendingRemove || !ActiveEffect->Spec.Def
+			|| ActiveEffect->Spec.Def->DurationPolicy != EGameplayEffectDurationType::HasDuration)
 		{
-			GameState->MulticastRefreshHUDGameplayEffects();
+			continue;
 		}
+
+		NewState.EffectMask |= 1u << (GetTypeHash(ActiveEffect->Spec.Def) % 32);
+		NumEffects++;
+	}
+	NewState.NumEffects = static_cast<uint8>(FMath::Min(NumEffects, static_cast<int32>(MAX_uint8)));
+
+	// Applying and refreshing instant effects, e.g. score and lives pickups, doesn't change what the HUD shows.
+	if (NewState == GameplayEffectsHUDState)
+	{
+		return;
+	}
+
+	GameplayEffectsHUDState = NewState;
+
+	// If this is a P2P host, trigger manually
+	if (!IsRunningDedicatedServer())
+	{
+		RepNotify_GameplayEffectsHUDState();
 	}
 }
+
@@ -15,6 +15,9 @@ class UAccelByteWarsAttributeSet;
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnEquippedItemsLoaded, APlayerState* /*Owner*/)
 
+// Number of equipped item slots, one per EItemType value. The player can only have one item equipped for each type.
+#define EQUIPPED_ITEM_SLOT_NUM 6
+
 	USTRUCT(BlueprintType)
 struct FEquippedItem
 {
@@ -34,6 +37,35 @@ public:
 	}
 };
 
+/**
+ * @brief Compact signature of the active duration gameplay effects shown on the HUD.
+ * The mask only tells whether the set of effects changed, clients read the effects themselves from the ability system component.
+ */
+USTRUCT()
+struct FGameplayEffectsHUDState
+{
+	GENERATED_BODY()
+
+public:
+	// One bit per active effect definition, hashed on the server.
+	UPROPERTY()
+	uint32 EffectMask = 0;
+
+	// Number of active effects, changes when an effect is reapplied while an older instance is still active.
+	UPROPERTY()
+	uint8 NumEffects = 0;
+
+	bool operator==(const FGameplayEffectsHUDState& Other) const
+	{
+		return Other.EffectMask == EffectMask && Other.NumEffects == NumEffects;
+	}
+
+	bool operator!=(const FGameplayEffectsHUDState& Other) const
+	{
+		return !(*this == Other);
+	}
+};
+
 UCLASS()
 class ACCELBYTEWARS_API AAccelByteWarsPlayerState : public APlayerState, public IAbilitySystemInterface
 {
@@ -83,6 +115,9 @@ public:
 	UFUNCTION()
 	void RepNotify_EquippedItemsChanged();
 
+	UFUNCTION()
+	void RepNotify_GameplayEffectsHUDState();
+
 	UPROPERTY(Replicated, ReplicatedUsing = "RepNotify_PendingTeamAssignment")
 	bool bPendingTeamAssignment = false;
 
@@ -96,7 +131,7 @@ public:
 	 * @param bForce Set to true to ignore the quantity requirement
 	 */
 	UFUNCTION(BlueprintPure)
-	FString GetEquippedItemId(const EItemType ItemType, const bool bForce = false);
+	FString GetEquippedItemId(const EItemType ItemType, const bool bForce = false) const;
 
 	/**
 	 * @brief Get currently equipped item by Item Type. Return empty if the quantity is less than 0 or no equipped item with given type
@@ -104,7 +139,7 @@ public:
 	 * @param bForce Set to true to ignore the quantity requirement
 	 */
 	UFUNCTION(BlueprintPure)
-	FEquippedItem GetEquippedItem(const EItemType ItemType, const bool bForce = false);
+	FEquippedItem GetEquippedItem(const EItemType ItemType, const bool bForce = false) const;
 
 	/**
 	 * @brief Decrease equipped item count by EItemType
@@ -137,6 +172,12 @@ protected:
 	UFUNCTION()
 	void OnActiveGameplayEffectRemoved(const FActiveGameplayEffect& RemovedEffect);
 
+	/**
+	 * @brief Recalculate the HUD gameplay effects state and replicate it only if it changed. Server only.
+	 * @param RemovedEffectHandle Effect that is being removed but may still be in the active effects container
+	 */
+	void UpdateGameplayEffectsHUDState(const FActiveGameplayEffectHandle& RemovedEffectHandle = FActiveGameplayEffectHandle());
+
 protected:
 	// GAS Components
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "GAS")
@@ -147,9 +188,17 @@ protected:
 
 	/*
 	 * @brief Used in server client logic only, for replication reason. Use the one in GameInstance for anything else.
+	 * Indexed by EItemType and replicated per slot, so equipping an item or changing its count only sends that slot.
 	 */
-	UPROPERTY(BlueprintReadWrite, Category = Attributes, ReplicatedUsing = RepNotify_EquippedItemsChanged)
-	TArray<FEquippedItem> EquippedItems;
+	UPROPERTY(ReplicatedUsing = RepNotify_EquippedItemsChanged)
+	FEquippedItem EquippedItemSlots[EQUIPPED_ITEM_SLOT_NUM];
+
+	/** @brief Return the equipped item slot of the given type, nullptr if the type has no slot. */
+	FEquippedItem* GetEquippedItemSlot(const EItemType ItemType);
+	const FEquippedItem* GetEquippedItemSlot(const EItemType ItemType) const;
+
+	UPROPERTY(ReplicatedUsing = RepNotify_GameplayEffectsHUDState)
+	FGameplayEffectsHUDState GameplayEffectsHUDState;
 
 	UFUNCTION(Server, Reliable)
 	void ServerUpdateEquippedItems(const TArray<FEquippedItem>& Items);
@@ -0,0 +1,136 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/Settings/GameModeDataLookup.h"
+
+FGameModeDataLookup::~FGameModeDataLookup()
+{
+	Reset();
+}
+
+void FGameModeDataLookup::Refresh(const UDataTable* InGameModeTable, const UDataTable* InGameModeTypeTable)
+{
+	if (!bIsDirty && GameModeTable.Get() == InGameModeTable && GameModeTypeTable.Get() == InGameModeTypeTable)
+	{
+		return;
+	}
+
+	Reset();
+	GameModeTable = InGameModeTable;
+	GameModeTypeTable = InGameModeTypeTable;
+	Build();
+}
+
+const TArray<FString>& FGameModeDataLookup::GetCodeNamesByType(const EGameModeType Type) const
+{
+	static const TArray<FString> EmptyCodeNames;
+
+	const TArray<FString>* FoundCodeNames = CodeNamesByType.Find(Type);
+	return FoundCodeNames ? *FoundCodeNames : EmptyCodeNames;
+}
+
+const FGameModeData* FGameModeDataLookup::FindGameModeByCodeName(const FString& CodeName) const
+{
+	const FGameModeData* const* FoundData = GameModesByCodeName.Find(CodeName);
+	return FoundData ? *FoundData : nullptr;
+}
+
+const FGameModeData* FGameModeDataLookup::FindGameModeById(const FName& RowName) const
+{
+	const FGameModeData* const* FoundData = GameModesById.Find(RowName);
+	return FoundData ? *FoundData : nullptr;
+}
+
+const FGameModeTypeData* FGameModeDataLookup::FindGameModeType(const EGameModeType Type) const
+{
+	const FGameModeTypeData* const* FoundData = GameModeTypesByType.Find(Type);
+	return FoundData ? *FoundData : nullptr;
+}
+
+void FGameModeDataLookup::Build()
+{
+	bIsDirty = false;
+
+	if (const UDataTable* Table = GameModeTable.Get();
+		Table && Table->GetRowStruct() && ensure(Table->GetRowStruct()->IsChildOf(FGameModeData::StaticStruct())))
+	{
+		for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+		{
+			const FGameModeData* GameModeData = reinterpret_cast<const FGameModeData*>(Row.Value);
+			if (!GameModeData)
+			{
+				continue;
+			}
+
+			GameModes.Add(GameModeData);
+			CodeNames.Add(GameModeData->CodeName);
+			CodeNamesByType.FindOrAdd(GameModeData->GameModeType).Add(GameModeData->CodeName);
+			GameModesById.Add(Row.Key, GameModeData);
+			if (!GameModesByCodeName.Contains(GameModeData->CodeName))
+			{
+				GameModesByCodeName.Add(GameModeData->CodeName, GameModeData);
+			}
+		}
+	}
+
+	if (const UDataTable* Table = GameModeTypeTable.Get();
+		Table && Table->GetRowStruct() && ensure(Table->GetRowStruct()->IsChildOf(FGameModeTypeData::StaticStruct())))
+	{
+		for (const TPair<FName, uint8*>& Row : Table->GetRowMap())
+		{
+			const FGameModeTypeData* TypeData = reinterpret_cast<const FGameModeTypeData*>(Row.Value);
+			if (!TypeData)
+			{
+				continue;
+			}
+
+			GameModeTypes.Add(TypeData);
+			GameModeTypeEnums.Add(TypeData->Type);
+			if (!GameModeTypesByType.Contains(TypeData->Type))
+			{
+				GameModeTypesByType.Add(TypeData->Type, TypeData);
+			}
+		}
+	}
+
+#if WITH_EDITOR
+	// The rows are reallocated when a table is edited or reimported.
+	if (UDataTable* Table = const_cast<UDataTable*>(GameModeTable.Get()))
+	{
+		Table->OnDataTableChanged().AddRaw(this, &FGameModeDataLookup::MarkDirty);
+	}
+	if (UDataTable* Table = const_cast<UDataTable*>(GameModeTypeTable.Get()))
+	{
+		Table->OnDataTableChanged().AddRaw(this, &FGameModeDataLookup::MarkDirty);
+	}
+#endif
+}
+
+void FGameModeDataLookup::Reset()
+{
+#if WITH_EDITOR
+	if (UDataTable* Table = const_cast<UDataTable*>(GameModeTable.Get()))
+	{
+		Table->OnDataTableChanged().RemoveAll(this);
+	}
+	if (UDataTable* Table = const_cast<UDataTable*>(GameModeTypeTable.Get()))
+	{
+		Table->OnDataTableChanged().RemoveAll(this);
+	}
+#endif
+
+	GameModeTable.Reset();
+	GameModeTypeTable.Reset();
+	bIsDirty = true;
+
+	GameModes.Empty();
+	CodeNames.Empty();
+	GameModesByCodeName.Empty();
+	GameModesById.Empty();
+	CodeNamesByType.Empty();
+
+	GameModeTypes.Empty();
+	GameModeTypeEnums.Empty();
+	GameModeTypesByType.Empty();
+}
@@ -0,0 +1,59 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Settings/GameModeDataAssets.h"
+
+/**
+ * @brief Index of the game mode and game mode type data tables, built once and reused by every lookup.
+ * The rows are referenced in place, so the index is rebuilt whenever a table is swapped or, in editor, changed.
+ */
+class ACCELBYTEWARS_API FGameModeDataLookup
+{
+public:
+	FGameModeDataLookup() = default;
+	FGameModeDataLookup(const FGameModeDataLookup&) = delete;
+	FGameModeDataLookup& operator=(const FGameModeDataLookup&) = delete;
+	~FGameModeDataLookup();
+
+	/**
+	 * @brief Make sure the index is built from the given tables. Does nothing if it is already up to date.
+	 */
+	void Refresh(const UDataTable* InGameModeTable, const UDataTable* InGameModeTypeTable = nullptr);
+
+	// Game modes in the table order.
+	const TArray<const FGameModeData*>& GetGameModes() const { return GameModes; }
+	const TArray<FString>& GetCodeNames() const { return CodeNames; }
+	const TArray<FString>& GetCodeNamesByType(const EGameModeType Type) const;
+
+	/** @brief Case-insensitive, the first row wins if multiple rows share the code name. */
+	const FGameModeData* FindGameModeByCodeName(const FString& CodeName) const;
+	const FGameModeData* FindGameModeById(const FName& RowName) const;
+
+	// Game mode types in the table order.
+	const TArray<const FGameModeTypeData*>& GetGameModeTypes() const { return GameModeTypes; }
+	const TArray<EGameModeType>& GetGameModeTypeEnums() const { return GameModeTypeEnums; }
+	const FGameModeTypeData* FindGameModeType(const EGameModeType Type) const;
+
+private:
+	void Build();
+	void Reset();
+	void MarkDirty() { bIsDirty = true; }
+
+	TWeakObjectPtr<const UDataTable> GameModeTable;
+	TWeakObjectPtr<const UDataTable> GameModeTypeTable;
+	bool bIsDirty = true;
+
+	TArray<const FGameModeData*> GameModes;
+	TArray<FString> CodeNames;
+	TMap<FString, const FGameModeData*> GameModesByCodeName;
+	TMap<FName, const FGameModeData*> GameModesById;
+	TMap<EGameModeType, TArray<FString>> CodeNamesByType;
+
+	TArray<const FGameModeTypeData*> GameModeTypes;
+	TArray<EGameModeType> GameModeTypeEnums;
+	TMap<EGameModeType, const FGameModeTypeData*> GameModeTypesByType;
+};
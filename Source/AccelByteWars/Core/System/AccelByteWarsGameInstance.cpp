@@ -14,8 +14,10 @@
 #include "Core/UI/AccelByteWarsBaseUI.h"
 #include "Core/UI/Components/Prompt/FTUE/FTUEDialogueWidget.h"
 #include "Core/UI/AccelByteWarsActivatableWidget.h"
+#include "Core/Utilities/AccelByteWarsImageCache.h"
 #include "GameFramework/OnlineSession.h"
 #include "Kismet/GameplayStatics.h"
+#include "Kismet/KismetSystemLibrary.h"
 
 #pragma region "Lobby Connect/Disconnect using PS Controller"
 #ifdef AGS_LOBBY_CHEAT_ENABLED
@@ -46,6 +48,8 @@ void UAccelByteWarsGameInstance::Shutdown()
 {
 	OnGameInstanceShutdownDelegate.Broadcast();
 
+	FAccelByteWarsImageCache::ClearCache();
+
 	Super::Shutdown();
 }
 
@@ -118,6 +122,58 @@ void UAccelByteWarsGameInstance::ModifyEquippedItemCountByInGameItemId(
 	}
 }
 
+void UAccelByteWarsGameInstance::BuildItemDataAssetsBySku()
+{
+	ItemDataAssetsBySku.Empty();
+
+	TArray<FPrimaryAssetId> PrimaryAssetIdList;
+	UKismetSystemLibrary::GetPrimaryAssetIdList(UInGameItemDataAsset::InGameItemAssetType, PrimaryAssetIdList);
+	for (const FPrimaryAssetId& AssetId : PrimaryAssetIdList)
+	{
+		UInGameItemDataAsset* Item = Cast<UInGameItemDataAsset>(UKismetSystemLibrary::GetObjectFromPrimaryAssetId(AssetId));
+		if (!Item)
+		{
+			continue;
+		}
+
+		for (const TTuple<EItemSkuPlatform, FString>& Sku : Item->SkuMap)
+		{
+			// Keep the first item if multiple items share the same SKU.
+			TMap<FString, TWeakObjectPtr<UInGameItemDataAsset>>& PlatformItems = ItemDataAssetsBySku.FindOrAdd(Sku.Key);
+			if (!PlatformItems.Contains(Sku.Value))
+			{
+				PlatformItems.Add(Sku.Value, Item);
+			}
+		}
+	}
+}
+
+UInGameItemDataAsset* UAccelByteWarsGameInstance::FindItemDataAssetBySku(const EItemSkuPlatform Platform, const FString& Sku)
+{
+	// The item data assets are loaded by the asset manager, build the index the first time it is needed.
+	if (ItemDataAssetsBySku.IsEmpty())
+	{
+		BuildItemDataAssetsBySku();
+	}
+
+	const TMap<FString, TWeakObjectPtr<UInGameItemDataAsset>>* PlatformItems = ItemDataAssetsBySku.Find(Platform);
+	const TWeakObjectPtr<UInGameItemDataAsset>* Item = PlatformItems ? PlatformItems->Find(Sku) : nullptr;
+	if (!Item)
+	{
+		return nullptr;
+	}
+
+	// Rebuild if the item data asset has been unloaded or reloaded since the index was built.
+	if (!Item->IsValid())
+	{
+		BuildItemDataAssetsBySku();
+		PlatformItems = ItemDataAssetsBySku.Find(Platform);
+		Item = PlatformItems ? PlatformItems->Find(Sku) : nullptr;
+	}
+
+	return Item ? Item->Get() : nullptr;
+}
+
 bool UAccelByteWarsGameInstance::UpdateEquippedItemsBySku(
 	const int32 PlayerIndex,
 	const EItemSkuPlatform Platform,
@@ -129,7 +185,7 @@ bool UAccelByteWarsGameInstance::UpdateEquippedItemsBySku(
 	TArray<FEquippedItem> InItems;
 	for (const TTuple<FString, int>& Sku : Skus)
 	{
-		if (const UInGameItemDataAsset* ItemDataAsset = UInGameItemUtility::GetItemDataAssetBySku(Platform, Sku.Key))
+		if (const UInGameItemDataAsset* ItemDataAsset = FindItemDataAssetBySku(Platform, Sku.Key))
 		{
 			InItems.Add({ItemDataAsset->Type, ItemDataAsset->Id, Sku.Value});
 			bSucceeded = true;
@@ -151,7 +207,7 @@ void UAccelByteWarsGameInstance::UnEquipItemBySku(
 {
 	if (TArray<FEquippedItem>* PlayerItems = EquippedItems.Find(PlayerIndex))
 	{
-		const UInGameItemDataAsset* ItemDataAsset = UInGameItemUtility::GetItemDataAssetBySku(Platform, Sku);
+		const UInGameItemDataAsset* ItemDataAsset = FindItemDataAssetBySku(Platform, Sku);
 		if (!ItemDataAsset)
 		{
 			return;
@@ -174,7 +230,7 @@ bool UAccelByteWarsGameInstance::IsItemEquippedBySku(
 	if (TArray<FEquippedItem>* PlayerItems = EquippedItems.Find(PlayerIndex))
 	{
 		FString ItemId;
-		if (const UInGameItemDataAsset* ItemDataAsset = UInGameItemUtility::GetItemDataAssetBySku(Platform, Sku))
+		if (const UInGameItemDataAsset* ItemDataAsset = FindItemDataAssetBySku(Platform, Sku))
 		{
 			ItemId = ItemDataAsset->Id;
 		}
@@ -341,26 +397,32 @@ TSubclassOf<UOnlineSession> UAccelByteWarsGameInstance::GetOnlineSessionClass()
 	return OnlineSessionClass ? OnlineSessionClass : Super::GetOnlineSessionClass();
 }
 
-FGameModeData UAccelByteWarsGameInstance::GetGameModeDataByCodeName(const FString CodeName) const
+const FGameModeData& UAccelByteWarsGameInstance::GetGameModeDataByCodeName(const FString& CodeName) const
 {
-	FGameModeData Data;
-	if (ensure(GameModeDataTable))
+	static const FGameModeData EmptyGameModeData;
+
+	if (!ensure(GameModeDataTable))
 	{
-		TArray<FGameModeData*> GameModeDatas;
-		GameModeDataTable->GetAllRows("GetGameModeDataByCodeName", GameModeDatas);
+		return EmptyGameModeData;
+	}
 
-		if (GameModeDatas.Num() > 0)
-		{
-			FGameModeData** DataPtr = GameModeDatas.FindByPredicate([CodeName](const FGameModeData* GameModeData)
-			{
-				return GameModeData->CodeName.Equals(CodeName);
-			});
+	GameModeDataLookup.Refresh(GameModeDataTable);
 
-			// if not found, use the first entry
-			Data = DataPtr ? **DataPtr : *GameModeDatas[0];
-		}
+	const TArray<const FGameModeData*>& GameModeDatas = GameModeDataLookup.GetGameModes();
+	if (GameModeDatas.IsEmpty())
+	{
+		return EmptyGameModeData;
 	}
-	return Data;
+
+	// The lookup ignores case, the code name has to match exactly.
+	const FGameModeData* Data = GameModeDataLookup.FindGameModeByCodeName(CodeName);
+	if (Data && Data->CodeName.Equals(CodeName))
+	{
+		return *Data;
+	}
+
+	// if not found, use the first entry
+	return *GameModeDatas[0];
 }
 
 bool UAccelByteWarsGameInstance::GetGameStatsDataById(const FName& Id, FGameStatsData& OutGameStatsData) const
@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "Core/Settings/GameModeDataAssets.h"
+#include "Core/Settings/GameModeDataLookup.h"
 #include "Core/Settings/GlobalSettingsDataAsset.h"
 #include "Engine/GameInstance.h"
 #include "CommonButtonBase.h"
@@ -156,6 +157,19 @@ protected:
 
 	void UpdateEquippedItems(const int32 PlayerIndex, const TArray<FEquippedItem>& InItems);
 
+	// In-game item data assets indexed by platform and SKU, built on first use.
+	TMap<EItemSkuPlatform, TMap<FString /*SKU*/, TWeakObjectPtr<UInGameItemDataAsset>>> ItemDataAssetsBySku;
+
+	void BuildItemDataAssetsBySku();
+
+	/**
+	 * @brief Find the in-game item data asset of the given SKU without scanning every item asset.
+	 * @param Platform 3rd party platform where this SKU supposed to be used
+	 * @param Sku Item SKU to find
+	 * @return The item data asset, nullptr if the SKU doesn't match any in-game item.
+	 */
+	UInGameItemDataAsset* FindItemDataAssetBySku(const EItemSkuPlatform Platform, const FString& Sku);
+
 public:
 
 	/**
@@ -302,7 +316,10 @@ public:
 	UFUNCTION(BlueprintPure)
 	FSlateSound GetDefaultButtonClickSound() const { return DefaultButtonClickSound; }
 
-	FGameModeData GetGameModeDataByCodeName(const FString CodeName) const;
+	/**
+	 * @brief Get the game mode data of the code name, or the first game mode if none matches
+	 */
+	const FGameModeData& GetGameModeDataByCodeName(const FString& CodeName) const;
 
 	bool GetGameStatsDataById(const FName& Id, FGameStatsData& OutGameStatsData) const;
 
@@ -342,6 +359,8 @@ protected:
 	UPROPERTY(EditAnywhere)
 	UDataTable* GameStatsDataTable;
 
+	mutable FGameModeDataLookup GameModeDataLookup;
+
 #pragma region "AccelByte SDK Config Menu"
 public:
 	// Open AccelByte SDK config menu to reconfigure the config on the fly.
@@ -6,38 +6,28 @@
 #include "Core/System/AccelByteWarsGlobals.h"
 
 
-TArray<FGameModeData*> UAccelByteWarsGlobals::GetAllGameModes() const
+const FGameModeDataLookup& UAccelByteWarsGlobals::GetGameModeDataLookup() const
 {
-	TArray<FGameModeData*> GameModeDataArray;
-
-	if (ensure(GameModes))
-	{
-		GameModes->GetAllRows<FGameModeData>("UAccelByteWarsGlobals::GetAllGameModes", GameModeDataArray);
-	}
+	GameModeDataLookup.Refresh(GameModes, GameModeTypes);
+	return GameModeDataLookup;
+}
 
-	return GameModeDataArray;
+const TArray<const FGameModeData*>& UAccelByteWarsGlobals::GetAllGameModes() const
+{
+	ensure(GameModes);
+	return GetGameModeDataLookup().GetGameModes();
 }
 
 TArray<FString> UAccelByteWarsGlobals::GetAllGameModeCodeNames() const
 {
-	TArray<FString> CodeNames;
-
-	TArray<FGameModeData*> GameModeDataArray = GetAllGameModes();
-	for (FGameModeData* GameModeData : GameModeDataArray)
-	{
-		if (!GameModeData) continue;
-		CodeNames.Add(GameModeData->CodeName);
-	}
-
-	return CodeNames;
+	return GetGameModeDataLookup().GetCodeNames();
 }
 
-//FGameModeData* UAccelByteWarsGlobals::GetGameModeDataById(int32 GameModeId) const
 bool UAccelByteWarsGlobals::GetGameModeDataById(int32 GameModeId, UPARAM(ref) FGameModeData& OutGameModeData) const
 {
-	if (ensure(GameModes))
+	if (const FGameModeData* GameModeData = GetGameModeDataLookup().FindGameModeById(*FString::FromInt(GameModeId)))
 	{
-		GameModes->FindRow<FGameModeData>(*FString::FromInt(GameModeId), "UAccelByteWarsGlobals::GetGameModeDataById", false);
+		OutGameModeData = *GameModeData;
 		return true;
 	}
 
@@ -46,61 +36,32 @@ bool UAccelByteWarsGlobals::GetGameModeDataById(int32 GameModeId, UPARAM(ref) FG
 
 TArray<FString> UAccelByteWarsGlobals::GetGameModeDataByType(EGameModeType GameModeType) const
 {
-	TArray<FString> CodeNames;
-
-	TArray<FGameModeData*> GameModeDataArray = GetAllGameModes();
-	for (FGameModeData* GameModeData : GameModeDataArray)
-	{
-		if (!GameModeData) continue;
-		if(GameModeData->GameModeType == GameModeType)
-		{
-			CodeNames.Add(GameModeData->CodeName);
-		}
-	}
-	
-	return CodeNames;
+	return GetGameModeDataLookup().GetCodeNamesByType(GameModeType);
 }
 
-//FGameModeData* UAccelByteWarsGlobals::GetGameModeDataByCodeName(const FString& CodeName) const
 bool UAccelByteWarsGlobals::GetGameModeDataByCodeName(const FString& CodeName, UPARAM(ref) FGameModeData& OutGameModeData) const
 {
-	TArray<FGameModeData*> ModeDataArray = GetAllGameModes();
-	for (FGameModeData* ModeData : ModeDataArray)
+	if (const FGameModeData* GameModeData = GetGameModeDataLookup().FindGameModeByCodeName(CodeName))
 	{
-		if (ModeData && ModeData->CodeName == CodeName)
-		{
-			//return ModeData;
-			OutGameModeData = *ModeData;
-			return true;
-		}
+		OutGameModeData = *GameModeData;
+		return true;
 	}
 
 	return false;
 }
 
-TArray<FGameModeTypeData*> UAccelByteWarsGlobals::GetAllGameModeTypes() const
+const TArray<const FGameModeTypeData*>& UAccelByteWarsGlobals::GetAllGameModeTypes() const
 {
-	TArray<FGameModeTypeData*> GameModeTypeDatas;
-
-	if (ensure(GameModeTypes))
-	{
-		GameModeTypes->GetAllRows<FGameModeTypeData>("UAccelByteWarsGlobals::GetAllGameModeTypes", GameModeTypeDatas);
-	}
-
-	return GameModeTypeDatas;
+	ensure(GameModeTypes);
+	return GetGameModeDataLookup().GetGameModeTypes();
 }
 
-//FGameModeTypeData* UAccelByteWarsGlobals::GetGameModeTypeData(const EGameModeType Type) const
 bool UAccelByteWarsGlobals::GetGameModeTypeData(const EGameModeType Type, UPARAM(ref) FGameModeTypeData& OutGameModeTypeData) const
 {
-	TArray<FGameModeTypeData*> TypeDataArray = GetAllGameModeTypes();
-	for (FGameModeTypeData* TypeData : TypeDataArray)
+	if (const FGameModeTypeData* TypeData = GetGameModeDataLookup().FindGameModeType(Type))
 	{
-		if (TypeData && TypeData->Type == Type)
-		{
-			OutGameModeTypeData = *TypeData;
-			return true;
-		}
+		OutGameModeTypeData = *TypeData;
+		return true;
 	}
 
 	return false;
@@ -108,15 +69,5 @@ bool UAccelByteWarsGlobals::GetGameModeTypeData(const EGameModeType Type, UPARAM
 
 TArray<EGameModeType> UAccelByteWarsGlobals::GetAllGameModeTypesEnum() const
 {
-	TArray<EGameModeType> GameModeEnums;
-
-	TArray<FGameModeTypeData*> TypeDataArray = GetAllGameModeTypes();
-	for (FGameModeTypeData* TypeData : TypeDataArray)
-	{
-		if (!TypeData) continue;
-		GameModeEnums.Add(TypeData->Type);
-	}
-
-	return GameModeEnums;
+	return GetGameModeDataLookup().GetGameModeTypeEnums();
 }
-
@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
 #include "Core/Settings/GameModeDataAssets.h"
+#include "Core/Settings/GameModeDataLookup.h"
 #include "AccelByteWarsGlobals.generated.h"
 
 /**
@@ -20,7 +21,7 @@ class ACCELBYTEWARS_API UAccelByteWarsGlobals : public UObject
 // Game Mode Data
 public:
 	
-	TArray<FGameModeData*> GetAllGameModes() const;
+	const TArray<const FGameModeData*>& GetAllGameModes() const;
 
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get All Game Mode CodeNames"))
 	TArray<FString> GetAllGameModeCodeNames() const;
@@ -34,7 +35,7 @@ public:
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Game Mode by CodeName"))
 	bool GetGameModeDataByCodeName(const FString& CodeName, UPARAM(ref) FGameModeData& OutGameModeData) const;
 	
-	TArray<FGameModeTypeData*> GetAllGameModeTypes() const;
+	const TArray<const FGameModeTypeData*>& GetAllGameModeTypes() const;
 
 	UFUNCTION(BlueprintPure, meta = (DisplayName = "Get All Game Mode Type Enums"))
 	TArray<EGameModeType> GetAllGameModeTypesEnum() const;
@@ -47,4 +48,9 @@ protected:
 	class UDataTable* GameModes;
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = Game)
 	class UDataTable* GameModeTypes;
+
+private:
+	const FGameModeDataLookup& GetGameModeDataLookup() const;
+
+	mutable FGameModeDataLookup GameModeDataLookup;
 };
@@ -0,0 +1,252 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/System/AccelByteWarsServerTickGovernor.h"
+#include "Core/Actor/AccelByteWarsMissile.h"
+#include "Core/Actor/AccelByteWarsSpawner.h"
+#include "Core/Components/AccelByteWarsGameplayObjectComponent.h"
+#include "Core/GameModes/AccelByteWarsInGameGameMode.h"
+#include "Core/Player/AccelByteWarsBotController.h"
+#include "Engine/NetDriver.h"
+#include "EngineUtils.h"
+#include "GameFramework/PlayerState.h"
+#include "Misc/App.h"
+
+DEFINE_LOG_CATEGORY(LogAccelByteWarsServerTickGovernor);
+
+bool UAccelByteWarsServerTickGovernor::ShouldCreateSubsystem(UObject* Outer) const
+{
+	return IsRunningDedicatedServer() ? Super::ShouldCreateSubsystem(Outer) : false;
+}
+
+bool UAccelByteWarsServerTickGovernor::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAccelByteWarsServerTickGovernor::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	float TickRate = SERVER_TICK_GOVERNOR_DEFAULT_TICK_RATE;
+	FParse::Value(FCommandLine::Get(), TEXT("-ServerTickRate="), TickRate);
+	TickRate = FMath::Max(TickRate, 1.0f);
+	FrameBudget = 1.0f / TickRate;
+
+	// Cap the server frame rate to the budget, the governor keeps the frames inside it.
+	if (UNetDriver* NetDriver = InWorld.GetNetDriver())
+	{
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 5
+		NetDriver->SetNetServerMaxTickRate(FMath::RoundToInt(TickRate));
+#else
+		NetDriver->NetServerMaxTickRate = FMath::RoundToInt(TickRate);
+#endif
+	}
+
+	ActorSpawnedHandle = InWorld.AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &ThisClass::OnActorSpawned));
+
+	// Start at the tier the player count allows, the frame time takes over from there.
+	SetCurrentTier(GetPlayerCountTier());
+
+	SERVER_TICK_GOVERNOR_LOG(Log, TEXT("Server tick governor started with a frame budget of %.1f ms."), FrameBudget * 1000.0f);
+}
+
+void UAccelByteWarsServerTickGovernor::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+	}
+	ActorSpawnedHandle.Reset();
+
+	Super::Deinitialize();
+}
+
+void UAccelByteWarsServerTickGovernor::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UWorld* World = GetWorld();
+	if (!World || !World->HasBegunPlay())
+	{
+		return;
+	}
+
+	// Only measure the time spent working, the server sleeps for the rest of the frame to hold the tick rate.
+	const float FrameDeltaTime = FApp::GetDeltaTime();
+	const float FrameWorkTime = FMath::Max(0.0f, static_cast<float>(FrameDeltaTime - FApp::GetIdleTime()));
+	SmoothedFrameTime = FMath::Lerp(SmoothedFrameTime, FrameWorkTime, SERVER_TICK_GOVERNOR_SMOOTHING);
+
+	// Never go above the tier the player count allows.
+	const EServerTickTier PlayerCountTier = GetPlayerCountTier();
+	if (CurrentTier < PlayerCountTier)
+	{
+		DegradeTimer = 0.0f;
+		RecoverTimer = 0.0f;
+		SetCurrentTier(PlayerCountTier);
+		return;
+	}
+
+	// The load has to stay past a threshold for a while, and the two thresholds are apart, so the tier doesn't oscillate.
+	const float Load = SmoothedFrameTime / FrameBudget;
+	if (Load > SERVER_TICK_GOVERNOR_DEGRADE_LOAD && CurrentTier != EServerTickTier::MINIMAL)
+	{
+		RecoverTimer = 0.0f;
+		DegradeTimer += FrameDeltaTime;
+		if (DegradeTimer >= SERVER_TICK_GOVERNOR_DEGRADE_DELAY)
+		{
+			DegradeTimer = 0.0f;
+			SetCurrentTier(static_cast<EServerTickTier>(static_cast<uint8>(CurrentTier) + 1));
+		}
+	}
+	else if (Load < SERVER_TICK_GOVERNOR_RECOVER_LOAD && CurrentTier > PlayerCountTier)
+	{
+		DegradeTimer = 0.0f;
+		RecoverTimer += FrameDeltaTime;
+		if (RecoverTimer >= SERVER_TICK_GOVERNOR_RECOVER_DELAY)
+		{
+			RecoverTimer = 0.0f;
+			SetCurrentTier(static_cast<EServerTickTier>(static_cast<uint8>(CurrentTier) - 1));
+		}
+	}
+	else
+	{
+		DegradeTimer = 0.0f;
+		RecoverTimer = 0.0f;
+	}
+}
+
+TStatId UAccelByteWarsServerTickGovernor::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAccelByteWarsServerTickGovernor, STATGROUP_Tickables);
+}
+
+const UAccelByteWarsServerTickGovernor::FServerTickTierSettings& UAccelByteWarsServerTickGovernor::GetTierSettings(const EServerTickTier Tier)
+{
+	// Tick intervals are lower bounds, an actor keeps its own interval if it is already longer. Zero keeps the class default.
+	static const FServerTickTierSettings TierSettings[] =
+	{
+		// Game mode, missile, bot, spawner tick intervals, and net update frequency scale.
+		{ 0.0f, 0.0f, 0.0f, 0.0f, 1.0f },	// FULL
+		{ 0.1f, 0.05f, 0.1f, 0.25f, 0.75f },	// REDUCED
+		{ 0.2f, 0.066f, 0.2f, 0.5f, 0.5f }	// MINIMAL
+	};
+
+	return TierSettings[FMath::Clamp(static_cast<int32>(Tier), 0, static_cast<int32>(UE_ARRAY_COUNT(TierSettings)) - 1)];
+}
+
+EServerTickTier UAccelByteWarsServerTickGovernor::GetPlayerCountTier() const
+{
+	const AGameStateBase* GameState = GetWorld() ? GetWorld()->GetGameState() : nullptr;
+	if (!GameState)
+	{
+		return EServerTickTier::FULL;
+	}
+
+	int32 PlayerCount = 0;
+	for (const TObjectPtr<APlayerState>& PlayerState : GameState->PlayerArray)
+	{
+		if (PlayerState && !PlayerState->IsABot())
+		{
+			PlayerCount++;
+		}
+	}
+
+	if (PlayerCount >= SERVER_TICK_GOVERNOR_MINIMAL_PLAYER_COUNT)
+	{
+		return EServerTickTier::MINIMAL;
+	}
+
+	if (PlayerCount >= SERVER_TICK_GOVERNOR_REDUCED_PLAYER_COUNT)
+	{
+		return EServerTickTier::REDUCED;
+	}
+
+	return EServerTickTier::FULL;
+}
+
+void UAccelByteWarsServerTickGovernor::SetCurrentTier(const EServerTickTier NewTier)
+{
+	if (NewTier != CurrentTier)
+	{
+		SERVER_TICK_GOVERNOR_LOG(Log, TEXT("Server tick tier changed from %s to %s. Smoothed frame time: %.2f ms, budget: %.2f ms."),
+			*UEnum::GetValueAsString(CurrentTier),
+			*UEnum::GetValueAsString(NewTier),
+			SmoothedFrameTime * 1000.0f,
+			FrameBudget * 1000.0f);
+	}
+
+	CurrentTier = NewTier;
+
+	if (AAccelByteWarsInGameGameState* GameState = GetWorld() ? GetWorld()->GetGameState<AAccelByteWarsInGameGameState>() : nullptr)
+	{
+		GameState->ServerTickTier = CurrentTier;
+	}
+
+	ApplyTierToAllActors();
+	OnServerTickTierChangedDelegates.Broadcast(CurrentTier);
+}
+
+void UAccelByteWarsServerTickGovernor::ApplyTierToAllActors() const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		ApplyTierToActor(*It);
+	}
+}
+
+void UAccelByteWarsServerTickGovernor::ApplyTierToActor(AActor* Actor) const
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	const FServerTickTierSettings& Settings = GetTierSettings(CurrentTier);
+	const AActor* DefaultActor = Actor->GetClass()->GetDefaultObject<AActor>();
+
+	float TierTickInterval = INDEX_NONE;
+	if (Actor->IsA<AAccelByteWarsInGameGameMode>())
+	{
+		TierTickInterval = Settings.GameModeTickInterval;
+	}
+	else if (Actor->IsA<AAccelByteWarsMissile>())
+	{
+		TierTickInterval = Settings.MissileTickInterval;
+	}
+	else if (Actor->IsA<AAccelByteWarsBotController>())
+	{
+		TierTickInterval = Settings.BotTickInterval;
+	}
+	else if (Actor->IsA<AAccelByteWarsSpawner>())
+	{
+		TierTickInterval = Settings.SpawnerTickInterval;
+	}
+
+	if (TierTickInterval >= 0.0f)
+	{
+		Actor->SetActorTickInterval(FMath::Max(DefaultActor->PrimaryActorTick.TickInterval, TierTickInterval));
+	}
+
+	// Scale the net update frequency of the replicated gameplay objects, e.g. ships, missiles, and planets.
+	if (Actor->FindComponentByClass<UAccelByteWarsGameplayObjectComponent>())
+	{
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 5
+		Actor->SetNetUpdateFrequency(FMath::Max(DefaultActor->GetNetUpdateFrequency() * Settings.NetUpdateFrequencyScale, DefaultActor->GetMinNetUpdateFrequency()));
+#else
+		Actor->NetUpdateFrequency = FMath::Max(DefaultActor->NetUpdateFrequency * Settings.NetUpdateFrequencyScale, DefaultActor->MinNetUpdateFrequency);
+#endif
+	}
+}
+
+void UAccelByteWarsServerTickGovernor::OnActorSpawned(AActor* Actor)
+{
+	ApplyTierToActor(Actor);
+}
@@ -0,0 +1,94 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/GameStates/AccelByteWarsInGameGameState.h"
+#include "AccelByteWarsServerTickGovernor.generated.h"
+
+ACCELBYTEWARS_API DECLARE_LOG_CATEGORY_EXTERN(LogAccelByteWarsServerTickGovernor, Log, All);
+
+#define SERVER_TICK_GOVERNOR_LOG(Verbosity, Format, ...) \
+{ \
+UE_LOG(LogAccelByteWarsServerTickGovernor, Verbosity, TEXT("%s"), *FString::Printf(Format, ##__VA_ARGS__)); \
+}
+
+// Server tick rate, the frame budget is derived from it. Can be overridden with the -ServerTickRate= launch argument.
+#define SERVER_TICK_GOVERNOR_DEFAULT_TICK_RATE 30.0f
+
+// Weight of the newest frame in the smoothed frame time.
+#define SERVER_TICK_GOVERNOR_SMOOTHING 0.05f
+
+// Fraction of the frame budget used above which the governor steps down a tier, and below which it steps back up.
+#define SERVER_TICK_GOVERNOR_DEGRADE_LOAD 0.85f
+#define SERVER_TICK_GOVERNOR_RECOVER_LOAD 0.5f
+
+// How long in seconds the load needs to stay past a threshold before the tier changes.
+#define SERVER_TICK_GOVERNOR_DEGRADE_DELAY 2.0f
+#define SERVER_TICK_GOVERNOR_RECOVER_DELAY 10.0f
+
+// Number of connected players from which the tier can't go above Reduced or Minimal regardless of the frame time.
+#define SERVER_TICK_GOVERNOR_REDUCED_PLAYER_COUNT 8
+#define SERVER_TICK_GOVERNOR_MINIMAL_PLAYER_COUNT 16
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnServerTickTierChanged, const EServerTickTier /*NewTier*/);
+
+/**
+ * @brief Adapts the tick intervals and net update frequencies of the gameplay actors on the dedicated server.
+ * The tier is picked from the measured frame time against the frame budget and from the player count,
+ * then applied to the existing and newly spawned gameplay actors and published through the game state.
+ */
+UCLASS()
+class ACCELBYTEWARS_API UAccelByteWarsServerTickGovernor : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	EServerTickTier GetCurrentTier() const { return CurrentTier; }
+	float GetFrameBudget() const { return FrameBudget; }
+
+	static inline FOnServerTickTierChanged OnServerTickTierChangedDelegates;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FServerTickTierSettings
+	{
+		float GameModeTickInterval;
+		float MissileTickInterval;
+		float BotTickInterval;
+		float SpawnerTickInterval;
+		float NetUpdateFrequencyScale;
+	};
+
+	static const FServerTickTierSettings& GetTierSettings(const EServerTickTier Tier);
+
+	EServerTickTier GetPlayerCountTier() const;
+	void SetCurrentTier(const EServerTickTier NewTier);
+
+	void ApplyTierToAllActors() const;
+	void ApplyTierToActor(AActor* Actor) const;
+	void OnActorSpawned(AActor* Actor);
+
+	EServerTickTier CurrentTier = EServerTickTier::FULL;
+
+	float FrameBudget = 1.0f / SERVER_TICK_GOVERNOR_DEFAULT_TICK_RATE;
+	float SmoothedFrameTime = 0.0f;
+
+	// Time the load has stayed past the degrade or the recover threshold.
+	float DegradeTimer = 0.0f;
+	float RecoverTimer = 0.0f;
+
+	FDelegateHandle ActorSpawnedHandle;
+};
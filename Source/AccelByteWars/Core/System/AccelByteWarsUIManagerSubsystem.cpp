@@ -6,6 +6,7 @@
 #include "Core/System/AccelByteWarsUIManagerSubsystem.h"
 #include "Core/UI/GameUIController.h"
 #include "Core/UI/AccelByteWarsBaseUI.h"
+#include "Core/UI/AccelByteWarsWidgetRegistry.h"
 #include "GameFramework/HUD.h"
 #include "Core/Player/CommonLocalPlayer.h"
 
@@ -19,6 +20,9 @@ void UAccelByteWarsUIManagerSubsystem::Initialize(FSubsystemCollectionBase& Coll
 	Super::Initialize(Collection);
 
 	TickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UAccelByteWarsUIManagerSubsystem::Tick), 0.0f);
+
+	// Index the user widgets by name, so the FTUE and widget validators can find them without iterating all widgets.
+	FAccelByteWarsWidgetRegistry::StartListening();
 }
 
 void UAccelByteWarsUIManagerSubsystem::Deinitialize()
@@ -26,6 +30,8 @@ void UAccelByteWarsUIManagerSubsystem::Deinitialize()
 	Super::Deinitialize();
 
 	FTSTicker::GetCoreTicker().RemoveTicker(TickHandle);
+
+	FAccelByteWarsWidgetRegistry::StopListening();
 }
 
 bool UAccelByteWarsUIManagerSubsystem::Tick(float DeltaTime)
@@ -331,6 +331,8 @@ void UAccelByteWarsActivatableWidget::ValidateGeneratedWidgets()
 
 void UAccelByteWarsActivatableWidget::InitializeGeneratedWidgets()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UAccelByteWarsActivatableWidget::InitializeGeneratedWidgets);
+
 	if (!IsVisible()) 
 	{
 		return;
@@ -353,8 +355,7 @@ void UAccelByteWarsActivatableWidget::InitializeGeneratedWidgets()
 	UAccelByteWarsBaseUI* BaseUIWidget = GameInstance->GetBaseUIWidget();
 	ensure(BaseUIWidget);
 
-	// Initialize the generated widgets.
-	GeneratedWidgets.Sort();
+	// Initialize the generated widgets. They are already ordered by spawn order when the Tutorial Modules assign them.
 	for (FTutorialModuleGeneratedWidget* GeneratedWidget : GeneratedWidgets)
 	{
 		if ((!GeneratedWidget->OwnerTutorialModule || !GeneratedWidget->OwnerTutorialModule->IsActiveAndDependenciesChecked()) ||
@@ -1177,14 +1178,12 @@ void UAccelByteWarsActivatableWidget::ExecuteWidgetValidators()
 		// Look for widget to validate.
 		const FString WidgetToValidateStr = Validator->TargetWidgetNameToValidate;
 
-		TArray<UUserWidget*> FoundWidgets;
-		UWidgetBlueprintLibrary::GetAllWidgetsOfClass(this, FoundWidgets, Validator->TargetWidgetClassToValidate.Get(), false);
-
-		// Eliminate invalid found widgets.
-		FoundWidgets.RemoveAll([WidgetToValidateStr](const UUserWidget* Temp)
-		{
-			return !Temp || !Temp->GetName().Equals(WidgetToValidateStr) || !Temp->IsVisible();
-		});
+		const TArray<UUserWidget*> FoundWidgets =
+			AccelByteWarsUtility::FindWidgetsOnTheScreen(
+				WidgetToValidateStr,
+				Validator->TargetWidgetClassToValidate.Get(),
+				false,
+				this);
 		if (FoundWidgets.IsEmpty()) 
 		{
 			continue;
@@ -0,0 +1,157 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/UI/AccelByteWarsWidgetRegistry.h"
+#include "Blueprint/UserWidget.h"
+
+FAccelByteWarsWidgetRegistry::FWidgetObjectListener FAccelByteWarsWidgetRegistry::Listener;
+int32 FAccelByteWarsWidgetRegistry::ListenerRefCount = 0;
+FCriticalSection FAccelByteWarsWidgetRegistry::WidgetsLock;
+TMap<FName, TArray<FAccelByteWarsWidgetRegistry::FRegisteredWidget>> FAccelByteWarsWidgetRegistry::WidgetsByName;
+TMap<int32, FName> FAccelByteWarsWidgetRegistry::NamesByObjectIndex;
+
+void FAccelByteWarsWidgetRegistry::StartListening()
+{
+	check(IsInGameThread());
+
+	if (ListenerRefCount++ > 0)
+	{
+		return;
+	}
+
+	GUObjectArray.AddUObjectCreateListener(&Listener);
+	GUObjectArray.AddUObjectDeleteListener(&Listener);
+
+	// Register the user widgets created before the listener was added.
+	for (TObjectIterator<UUserWidget> It(RF_ClassDefaultObject | RF_ArchetypeObject); It; ++It)
+	{
+		RegisterWidget(*It, GUObjectArray.ObjectToIndex(*It));
+	}
+}
+
+void FAccelByteWarsWidgetRegistry::StopListening()
+{
+	check(IsInGameThread());
+
+	if (ListenerRefCount <= 0 || --ListenerRefCount > 0)
+	{
+		return;
+	}
+
+	RemoveListener();
+}
+
+bool FAccelByteWarsWidgetRegistry::FindWidgets(
+	const FName& WidgetName,
+	const UClass* WidgetClass,
+	const UObject* Context,
+	TArray<UUserWidget*>& OutWidgets)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FAccelByteWarsWidgetRegistry::FindWidgets);
+
+	OutWidgets.Reset();
+
+	FScopeLock Lock(&WidgetsLock);
+
+	const TArray<FRegisteredWidget>* Widgets = WidgetsByName.Find(WidgetName);
+	if (!Widgets)
+	{
+		return false;
+	}
+
+	const UWorld* World = Context ? Context->GetWorld() : nullptr;
+	for (const FRegisteredWidget& RegisteredWidget : *Widgets)
+	{
+		UUserWidget* Widget = RegisteredWidget.Widget.Get();
+		if (Widget && (!WidgetClass || Widget->IsA(WidgetClass)) && (!World || Widget->GetWorld() == World))
+		{
+			OutWidgets.Add(Widget);
+		}
+	}
+
+	return !OutWidgets.IsEmpty();
+}
+
+void FAccelByteWarsWidgetRegistry::FWidgetObjectListener::NotifyUObjectCreated(const UObjectBase* Object, int32 Index)
+{
+	// Widgets on the screen are only created on the game thread, objects created on the loading threads are assets.
+	if (!IsInGameThread())
+	{
+		return;
+	}
+
+	// Only the base object is constructed at this point, but its class, name, and flags are already set.
+	UObject* CreatedObject = static_cast<UObject*>(const_cast<UObjectBase*>(Object));
+	if (CreatedObject->IsA<UUserWidget>())
+	{
+		RegisterWidget(static_cast<UUserWidget*>(CreatedObject), Index);
+	}
+}
+
+void FAccelByteWarsWidgetRegistry::FWidgetObjectListener::NotifyUObjectDeleted(const UObjectBase* Object, int32 Index)
+{
+	UnregisterWidget(Index);
+}
+
+void FAccelByteWarsWidgetRegistry::FWidgetObjectListener::OnUObjectArrayShutdown()
+{
+	RemoveListener();
+}
+
+void FAccelByteWarsWidgetRegistry::RegisterWidget(UUserWidget* Widget, const int32 ObjectIndex)
+{
+	if (!Widget || Widget->HasAnyFlags(RF_ClassDefaultObject | RF_ArchetypeObject))
+	{
+		return;
+	}
+
+	FScopeLock Lock(&WidgetsLock);
+
+	if (NamesByObjectIndex.Contains(ObjectIndex))
+	{
+		return;
+	}
+
+	FRegisteredWidget& RegisteredWidget = WidgetsByName.FindOrAdd(Widget->GetFName()).AddDefaulted_GetRef();
+	RegisteredWidget.Widget = Widget;
+	RegisteredWidget.ObjectIndex = ObjectIndex;
+	NamesByObjectIndex.Add(ObjectIndex, Widget->GetFName());
+}
+
+void FAccelByteWarsWidgetRegistry::UnregisterWidget(const int32 ObjectIndex)
+{
+	FScopeLock Lock(&WidgetsLock);
+
+	FName WidgetName;
+	if (!NamesByObjectIndex.RemoveAndCopyValue(ObjectIndex, WidgetName))
+	{
+		return;
+	}
+
+	TArray<FRegisteredWidget>* Widgets = WidgetsByName.Find(WidgetName);
+	if (!Widgets)
+	{
+		return;
+	}
+
+	Widgets->RemoveAllSwap([ObjectIndex](const FRegisteredWidget& Temp)
+	{
+		return Temp.ObjectIndex == ObjectIndex;
+	});
+	if (Widgets->IsEmpty())
+	{
+		WidgetsByName.Remove(WidgetName);
+	}
+}
+
+void FAccelByteWarsWidgetRegistry::RemoveListener()
+{
+	GUObjectArray.RemoveUObjectCreateListener(&Listener);
+	GUObjectArray.RemoveUObjectDeleteListener(&Listener);
+	ListenerRefCount = 0;
+
+	FScopeLock Lock(&WidgetsLock);
+	WidgetsByName.Empty();
+	NamesByObjectIndex.Empty();
+}
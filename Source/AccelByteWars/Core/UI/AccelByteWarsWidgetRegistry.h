@@ -0,0 +1,62 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/UObjectArray.h"
+
+class UUserWidget;
+
+/**
+ * @brief Live user widgets indexed by their widget name, so the FTUE highlights and widget validators
+ * can find their target widgets without iterating every object of the target class.
+ * While listening, every user widget is registered when it is created and unregistered when it is deleted,
+ * including the widgets created after their parent, such as list entries and dynamically generated widgets.
+ * The registry is authoritative, a widget that is not registered does not exist.
+ */
+class ACCELBYTEWARS_API FAccelByteWarsWidgetRegistry
+{
+public:
+	/** @brief Start or stop listening to the user widget creation. Calls are counted, so each start needs a stop. */
+	static void StartListening();
+	static void StopListening();
+
+	/**
+	 * @brief Find the registered widgets with the given name and class that belong to the world of the context.
+	 * @return False if none of the registered widgets matches.
+	 */
+	static bool FindWidgets(
+		const FName& WidgetName,
+		const UClass* WidgetClass,
+		const UObject* Context,
+		TArray<UUserWidget*>& OutWidgets);
+
+private:
+	class FWidgetObjectListener : public FUObjectArray::FUObjectCreateListener, public FUObjectArray::FUObjectDeleteListener
+	{
+	public:
+		virtual void NotifyUObjectCreated(const UObjectBase* Object, int32 Index) override;
+		virtual void NotifyUObjectDeleted(const UObjectBase* Object, int32 Index) override;
+		virtual void OnUObjectArrayShutdown() override;
+	};
+
+	struct FRegisteredWidget
+	{
+		TWeakObjectPtr<UUserWidget> Widget;
+		int32 ObjectIndex = INDEX_NONE;
+	};
+
+	static void RegisterWidget(UUserWidget* Widget, const int32 ObjectIndex);
+	static void UnregisterWidget(const int32 ObjectIndex);
+	static void RemoveListener();
+
+	static FWidgetObjectListener Listener;
+	static int32 ListenerRefCount;
+
+	// Widgets may be deleted outside of the game thread, so the maps are guarded.
+	static FCriticalSection WidgetsLock;
+	static TMap<FName, TArray<FRegisteredWidget>> WidgetsByName;
+	static TMap<int32 /*ObjectIndex*/, FName> NamesByObjectIndex;
+};
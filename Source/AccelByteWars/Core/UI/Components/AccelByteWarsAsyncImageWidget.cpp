@@ -8,7 +8,7 @@
 #include "Components/Border.h"
 #include "Components/ScaleBox.h"
 #include "CommonActivatableWidgetSwitcher.h"
-#include "Core/Utilities/AccelByteWarsUtility.h"
+#include "Core/Utilities/AccelByteWarsImageCache.h"
 
 void UAccelByteWarsAsyncImageWidget::LoadImage(const FString& ImageUrl)
 {
@@ -17,56 +17,68 @@ void UAccelByteWarsAsyncImageWidget::LoadImage(const FString& ImageUrl)
 		return;
 	}
 
-	const FString ImageId = FBase64::Encode(ImageUrl);
+	// The widget might be reused by a list view before the previous image is received.
+	CancelPendingImageRequest();
 
-	// Try to set avatar image from cache.
-	const FCacheBrush CacheAvatarBrush = AccelByteWarsUtility::GetImageFromCache(ImageId);
-	if (CacheAvatarBrush && CacheAvatarBrush.IsValid())
+	// If no valid avatar, reset it to the default one.
+	if (ImageUrl.IsEmpty())
 	{
-		B_Loaded->SetBrush(*CacheAvatarBrush.Get());
-		SetImageTint(FLinearColor::White);
-		Ws_Root->SetActiveWidget(B_Loaded);
+		Ws_Root->SetActiveWidget(B_Default);
+		return;
 	}
-	// Try to get avatar from absolute file path.
-	else if (UTexture2D* LocalAsset = LoadObject<UTexture2D>(GetTransientPackage(), *ImageUrl))
+
+	// Try to set avatar image from the memory cache.
+	if (const FCacheBrush CacheAvatarBrush = FAccelByteWarsImageCache::FindCachedImage(ImageUrl))
 	{
-		FSlateBrush Brush;
-		Brush.SetResourceObject(LocalAsset);
-		Brush.ImageSize = FVector2D(LocalAsset->GetSizeX(), LocalAsset->GetSizeY());
+		SetLoadedBrush(*CacheAvatarBrush.Get());
+		return;
+	}
 
-		B_Loaded->SetBrush(Brush);
-		SetImageTint(FLinearColor::White);
-		Ws_Root->SetActiveWidget(B_Loaded);
+	// Show the loading state while the image is loaded from disk or from URL in the background.
+	Ws_Root->SetActiveWidget(W_Loading);
+	PendingImageRequestId = FAccelByteWarsImageCache::RequestImage(
+		ImageUrl,
+		FOnImageReceived::CreateUObject(this, &ThisClass::OnImageReceived));
+	if (PendingImageRequestId != INDEX_NONE)
+	{
+		PendingImageUrl = ImageUrl;
 	}
-	// Set avatar image from URL if it is not exists in cache.
-	else if (!ImageUrl.IsEmpty())
+}
+
+void UAccelByteWarsAsyncImageWidget::OnImageReceived(const FCacheBrush ImageResult)
+{
+	PendingImageUrl.Empty();
+	PendingImageRequestId = INDEX_NONE;
+
+	if (ImageResult.IsValid())
 	{
-		Ws_Root->SetActiveWidget(W_Loading);
-		AccelByteWarsUtility::GetImageFromURL(
-			ImageUrl,
-			ImageId,
-			FOnImageReceived::CreateWeakLambda(this, [this](const FCacheBrush ImageResult)
-			{
-				if (ImageResult.IsValid())
-				{
-					B_Loaded->SetBrush(*ImageResult.Get());
-					SetImageTint(FLinearColor::White);
-					Ws_Root->SetActiveWidget(B_Loaded);
-				}
-				else
-				{
-					Ws_Root->SetActiveWidget(B_Default);
-				}
-			})
-		);
+		SetLoadedBrush(*ImageResult.Get());
 	}
-	// If no valid avatar, reset it to the default one.
-	else 
+	else
 	{
 		Ws_Root->SetActiveWidget(B_Default);
 	}
 }
 
+void UAccelByteWarsAsyncImageWidget::SetLoadedBrush(const FSlateBrush& Brush)
+{
+	B_Loaded->SetBrush(Brush);
+	SetImageTint(FLinearColor::White);
+	Ws_Root->SetActiveWidget(B_Loaded);
+}
+
+void UAccelByteWarsAsyncImageWidget::CancelPendingImageRequest()
+{
+	if (PendingImageRequestId == INDEX_NONE)
+	{
+		return;
+	}
+
+	FAccelByteWarsImageCache::CancelImageRequest(PendingImageUrl, PendingImageRequestId);
+	PendingImageUrl.Empty();
+	PendingImageRequestId = INDEX_NONE;
+}
+
 void UAccelByteWarsAsyncImageWidget::SetImageTint(const FLinearColor& Color)
 {
 	B_Default->SetBrushColor(Color);
@@ -83,3 +95,10 @@ void UAccelByteWarsAsyncImageWidget::NativePreConstruct()
 	B_Default->SetBrush(DefaultBrush);
 	SetImageTint(FLinearColor::White);
 }
+
+void UAccelByteWarsAsyncImageWidget::NativeDestruct()
+{
+	CancelPendingImageRequest();
+
+	Super::NativeDestruct();
+}
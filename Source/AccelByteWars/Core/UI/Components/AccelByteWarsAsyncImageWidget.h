@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "CommonUserWidget.h"
 #include "Widgets/Layout/SScaleBox.h"
+#include "Core/Utilities/AccelByteWarsUtility.h"
 #include "AccelByteWarsAsyncImageWidget.generated.h"
 
 class UCommonActivatableWidgetSwitcher;
@@ -47,8 +48,17 @@ public:
 
 protected:
 	virtual void NativePreConstruct() override;
+	virtual void NativeDestruct() override;
 
 private:
+	void OnImageReceived(const FCacheBrush ImageResult);
+	void SetLoadedBrush(const FSlateBrush& Brush);
+	void CancelPendingImageRequest();
+
+	// The image currently requested, so the request can be cancelled when the widget is reused or destroyed.
+	FString PendingImageUrl;
+	int32 PendingImageRequestId = INDEX_NONE;
+
 #pragma region "UI components"
 	UPROPERTY(BlueprintReadOnly, meta = (BindWidget, BlueprintProtected = true, AllowPrivateAccess = true))
 	UScaleBox* Sb_RootOuter;
@@ -33,23 +33,7 @@ void FFTUEDialogueModel::ExecuteValidation(const FOnFTUEDialogueValidationComple
 
 FFTUEDialogueModel* FFTUEDialogueModel::GetMetadataById(const FString& FTUEId)
 {
-	FFTUEDialogueModel* Result = nullptr;
-
-	for (const auto Metadata : UTutorialModuleDataAsset::GetCachedFTUEDialogues())
-	{
-		if (!Metadata)
-		{
-			continue;
-		}
-
-		if (Metadata->FTUEId.Equals(FTUEId))
-		{
-			Result = Metadata;
-			break;
-		}
-	}
-
-	return Result;
+	return UTutorialModuleDataAsset::FindCachedFTUEDialogueById(FTUEId);
 }
 
 void FFTUEDialogueModel::ValidateDialogues(const TArray<FFTUEDialogueModel*>& Dialogues, const UObject* Context,
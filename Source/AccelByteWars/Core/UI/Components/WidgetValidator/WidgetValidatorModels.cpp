@@ -55,14 +55,7 @@ void FWidgetValidator::ExecuteValidator(IAccelByteWarsWidgetInterface* Widget, c
 	}
 
 	// Start widget validator time out.
-	Async(EAsyncExecution::TaskGraph, [this]
-	{
-		FPlatformProcess::Sleep(ValidationTimeout);
-		AsyncTask(ENamedThreads::GameThread, [this]
-		{
-			OnValidatorTimeout();
-		});
-	});
+	StartValidatorTimeout();
 }
 
 void FWidgetValidator::FinalizeValidator(const bool bIsValidState, const FString& InvalidStateMessage, const bool bFallbackToDefaultInvalidMessage)
@@ -80,6 +73,7 @@ void FWidgetValidator::FinalizeValidator(const bool bIsValidState, const FString
 	}
 
 	bIsFinalized = true;
+	CancelValidatorTimeout();
 
 	FString FinalInvalidStateMessage = FString();
 	if (!bIsValidState)
@@ -97,6 +91,71 @@ void FWidgetValidator::FinalizeValidator(const bool bIsValidState, const FString
 	OnValidatorFinalizedDelegate.ExecuteIfBound(this, bIsValidState, FinalInvalidStateMessage);
 }
 
+void FWidgetValidator::StartValidatorTimeout()
+{
+	// Re-validating restarts the deadline, the previous one must not time out the new validation.
+	CancelValidatorTimeout();
+
+	/* The validator is owned by its Tutorial Module and the target widget may be destroyed before the deadline.
+	 * Only handle the timeout if both are still alive. */
+	const bool bHasOwner = OwnerTutorialModule != nullptr;
+	const TWeakObjectPtr<UTutorialModuleDataAsset> WeakOwner = OwnerTutorialModule;
+	const TWeakObjectPtr<UObject> WeakWidget = CachedWidget ? CachedWidget->_getUObject() : nullptr;
+
+	// Zero is reserved for validators without a scheduled deadline.
+	if (++NextTimeoutId == 0)
+	{
+		++NextTimeoutId;
+	}
+	TimeoutId = NextTimeoutId;
+	const uint32 ScheduledTimeoutId = TimeoutId;
+
+	TimeoutTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateLambda([ScheduledTimeoutId, bHasOwner, WeakOwner, WeakWidget](float DeltaTime)
+		{
+			if ((!bHasOwner || WeakOwner.IsValid()) && WeakWidget.IsValid())
+			{
+				if (FWidgetValidator* WidgetValidator = FindValidatorByTimeoutId(ScheduledTimeoutId, WeakOwner.Get()))
+				{
+					WidgetValidator->TimeoutTickerHandle.Reset();
+					WidgetValidator->TimeoutId = 0;
+					WidgetValidator->OnValidatorTimeout();
+				}
+			}
+
+			// Fire only once.
+			return false;
+		}),
+		ValidationTimeout);
+}
+
+FWidgetValidator* FWidgetValidator::FindValidatorByTimeoutId(const uint32 InTimeoutId, UTutorialModuleDataAsset* Owner)
+{
+	if (Owner)
+	{
+		return Owner->WidgetValidators.FindByPredicate([InTimeoutId](const FWidgetValidator& Temp)
+		{
+			return Temp.TimeoutId == InTimeoutId;
+		});
+	}
+
+	FWidgetValidator* const* Found = UTutorialModuleDataAsset::GetCachedWidgetValidators().FindByPredicate([InTimeoutId](const FWidgetValidator* Temp)
+	{
+		return Temp && Temp->TimeoutId == InTimeoutId;
+	});
+	return Found ? *Found : nullptr;
+}
+
+void FWidgetValidator::CancelValidatorTimeout()
+{
+	if (TimeoutTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TimeoutTickerHandle);
+		TimeoutTickerHandle.Reset();
+	}
+	TimeoutId = 0;
+}
+
 void FWidgetValidator::OnValidatorTimeout()
 {
 	// Abort if validation is already finalized.
@@ -122,21 +181,5 @@ void FWidgetValidator::OnValidatorTimeout()
 
 FWidgetValidator* FWidgetValidator::GetMetadataById(const FString& WidgetValidatorId)
 {
-	FWidgetValidator* Result = nullptr;
-
-	for (const auto Metadata : UTutorialModuleDataAsset::GetCachedWidgetValidators())
-	{
-		if (!Metadata)
-		{
-			continue;
-		}
-
-		if (Metadata->WidgetValidatorId.Equals(WidgetValidatorId))
-		{
-			Result = Metadata;
-			break;
-		}
-	}
-
-	return Result;
+	return UTutorialModuleDataAsset::FindCachedWidgetValidatorById(WidgetValidatorId);
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
 #include "Core/AssetManager/TutorialModules/TutorialModuleUtility.h"
 #include "Core/Utilities/AccelByteWarsUtilityLog.h"
 #include "WidgetValidatorModels.generated.h"
@@ -154,5 +155,16 @@ private:
 	float ValidationTimeout = 10.0f;
 	bool bIsTimeout = false;
 
+	// Validation deadline scheduled on the game thread core ticker, so no worker thread is held while waiting for it.
+	FTSTicker::FDelegateHandle TimeoutTickerHandle;
+
+	/* Validators live in Tutorial Module arrays that may be reallocated or reassigned before the deadline.
+	 * The ticker looks the validator up by this id instead of holding its address. */
+	uint32 TimeoutId = 0;
+	inline static uint32 NextTimeoutId = 0;
+
+	void StartValidatorTimeout();
+	static FWidgetValidator* FindValidatorByTimeoutId(const uint32 InTimeoutId, UTutorialModuleDataAsset* Owner);
+	void CancelValidatorTimeout();
 	void OnValidatorTimeout();
 };
\ No newline at end of file
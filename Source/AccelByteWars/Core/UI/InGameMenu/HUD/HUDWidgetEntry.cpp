@@ -26,18 +26,18 @@ void UHUDWidgetEntry::NativePreConstruct()
 	}
 	if (AAccelByteWarsGameState* GameState = GetWorld()->GetGameState<AAccelByteWarsGameState>())
 	{
-		GameStateTeamChangedHandle = GameState->OnTeamsChanged.AddUObject(this, &UHUDWidgetEntry::OnTeamDataChanged);
+		PlayerGameplayEffectsChangedHandle = GameState->OnPlayerGameplayEffectsChanged.AddUObject(this, &UHUDWidgetEntry::OnPlayerGameplayEffectsChanged);
 	}
 }
 
 void UHUDWidgetEntry::NativeDestruct()
 {
 	// Unbind from GameState delegate
-	if (GameStateTeamChangedHandle.IsValid())
+	if (PlayerGameplayEffectsChangedHandle.IsValid())
 	{
 		if (AAccelByteWarsGameState* GameState = GetWorld()->GetGameState<AAccelByteWarsGameState>())
 		{
-			GameState->OnTeamsChanged.Remove(GameStateTeamChangedHandle);
+			GameState->OnPlayerGameplayEffectsChanged.Remove(PlayerGameplayEffectsChangedHandle);
 		}
 	}
 
@@ -150,18 +150,22 @@ void UHUDWidgetEntry::Init(const FGameplayTeamData& Team)
 		PowerUpWidgetEntries[i]->SetVisibility(ESlateVisibility::Collapsed);
 	}
 
-	// Bind to GameState delegate for team changes (which includes gameplay effects)
-	if (AAccelByteWarsGameState* ABGameState = GetWorld()->GetGameState<AAccelByteWarsGameState>())
-	{
-		// Initial refresh of gameplay effects
-		RefreshGameplayEffectWidgets();
-	}
+	// Team members may have changed, refresh the gameplay effects of the whole team
+	RefreshGameplayEffectWidgets();
 }
 
-void UHUDWidgetEntry::OnTeamDataChanged()
+void UHUDWidgetEntry::OnPlayerGameplayEffectsChanged(APlayerState* PlayerState)
 {
-	// Refresh gameplay effects when team data changes (including when effects are applied/removed)
-	RefreshGameplayEffectWidgets();
+	if (!PlayerState || !CurrentTeam.TeamMembers.ContainsByPredicate([PlayerState](const FGameplayPlayerData& Member)
+	{
+		return Member.UniqueNetId == PlayerState->GetUniqueId();
+	}))
+	{
+		return;
+	}
+
+	// Only the effects of the changed player need to be updated.
+	RefreshPlayerGameplayEffectWidgets(Cast<AAccelByteWarsPlayerState>(PlayerState));
 }
 
 void UHUDWidgetEntry::RefreshGameplayEffectWidgets()
@@ -171,8 +175,6 @@ void UHUDWidgetEntry::RefreshGameplayEffectWidgets()
 		return;
 	}
 
-	Hb_GameplayEffects->ClearChildren();
-
 	// Get game state to access player states
 	const AAccelByteWarsInGameGameState* GameState = GetWorld()->GetGameState<AAccelByteWarsInGameGameState>();
 	if (!GameState)
@@ -180,9 +182,7 @@ void UHUDWidgetEntry::RefreshGameplayEffectWidgets()
 		return;
 	}
 
-	// Collect active effects from team members and update widgets
-	TArray<FGameplayEffectEntryKey> ValidKeys;
-
+	TSet<const UAbilitySystemComponent*> TeamASCs;
 	for (const FGameplayPlayerData& Member : CurrentTeam.TeamMembers)
 	{
 		// Find the player state for this team member
@@ -201,77 +201,94 @@ void UHUDWidgetEntry::RefreshGameplayEffectWidgets()
 			continue;
 		}
 
-		// Get the ability system component
-		UAbilitySystemComponent* ASC = ABPlayerState->GetAbilitySystemComponent();
-		if (!ASC)
+		TeamASCs.Add(ABPlayerState->GetAbilitySystemComponent());
+		RefreshPlayerGameplayEffectWidgets(ABPlayerState);
+	}
+
+	// Remove entries of players that are no longer in the team
+	for (auto It = GameplayEffectWidgetEntries.CreateIterator(); It; ++It)
+	{
+		if (!TeamASCs.Contains(It->Key.ASC.Get()))
 		{
-			continue;
+			if (It->Value.IsValid())
+			{
+				It->Value->RemoveFromParent();
+			}
+			It.RemoveCurrent();
 		}
+	}
+}
+
+void UHUDWidgetEntry::RefreshPlayerGameplayEffectWidgets(AAccelByteWarsPlayerState* PlayerState)
+{
+	if (!Hb_GameplayEffects || bHideGameplayEffectWidgets || !PlayerState)
+	{
+		return;
+	}
 
-		// Get active gameplay effects with duration
-		FGameplayEffectQuery Query;
-		Query.EffectDefinition = nullptr;
-		Query.OwningTagQuery = FGameplayTagQuery::EmptyQuery;
-		Query.SourceTagQuery = FGameplayTagQuery::EmptyQuery;
+	// Get the ability system component
+	UAbilitySystemComponent* ASC = PlayerState->GetAbilitySystemComponent();
+	if (!ASC)
+	{
+		return;
+	}
 
-		TArray<FActiveGameplayEffectHandle> ActiveEffects = ASC->GetActiveEffects(Query);
-		
-		for (const FActiveGameplayEffectHandle& EffectHandle : ActiveEffects)
+	// Collect active effects with duration of this player and update widgets
+	TArray<FGameplayEffectEntryKey> ValidKeys;
+	for (const FActiveGameplayEffectHandle& EffectHandle : ASC->GetActiveEffects(FGameplayEffectQuery()))
+	{
+		const FActiveGameplayEffect* ActiveEffect = ASC->GetActiveGameplayEffect(EffectHandle);
+		if (!ActiveEffect || !ActiveEffect->Spec.Def)
 		{
-			const FActiveGameplayEffect* ActiveEffect = ASC->GetActiveGameplayEffect(EffectHandle);
-			if (!ActiveEffect || !ActiveEffect->Spec.Def)
-			{
-				continue;
-			}
+			continue;
+		}
 
-			// Only show effects with duration
-			if (ActiveEffect->Spec.Def->DurationPolicy != EGameplayEffectDurationType::HasDuration)
-			{
-				continue;
-			}
+		// Only show effects with duration
+		if (ActiveEffect->Spec.Def->DurationPolicy != EGameplayEffectDurationType::HasDuration)
+		{
+			continue;
+		}
 
-			// Get remaining duration
-			float RemainingDuration = ASC->GetGameplayEffectDuration(EffectHandle);
-			if (RemainingDuration <= 0.0f)
-			{
-				continue;
-			}
+		// Get remaining duration
+		const float RemainingDuration = ASC->GetGameplayEffectDuration(EffectHandle);
+		if (RemainingDuration <= 0.0f)
+		{
+			continue;
+		}
 
-			FGameplayEffectEntryKey Key(ASC, ActiveEffect->Spec.Def);
-			ValidKeys.Add(Key);
+		FGameplayEffectEntryKey Key(ASC, ActiveEffect->Spec.Def);
+		ValidKeys.Add(Key);
 
-			// Create or update widget entry
-			if (!GameplayEffectWidgetEntries.Contains(Key))
-			{
-				TWeakObjectPtr<UGameplayEffectWidgetEntry> NewEntry = MakeWeakObjectPtr<UGameplayEffectWidgetEntry>(
-					CreateWidget<UGameplayEffectWidgetEntry>(this, GameplayEffectWidgetEntryClass.Get())
-				);
-				GameplayEffectWidgetEntries.Add(Key, NewEntry);
-			}
+		// Create or update widget entry
+		TWeakObjectPtr<UGameplayEffectWidgetEntry>& EffectEntry = GameplayEffectWidgetEntries.FindOrAdd(Key);
+		if (!EffectEntry.IsValid())
+		{
+			EffectEntry = MakeWeakObjectPtr<UGameplayEffectWidgetEntry>(
+				CreateWidget<UGameplayEffectWidgetEntry>(this, GameplayEffectWidgetEntryClass.Get())
+			);
+		}
 
-			TWeakObjectPtr<UGameplayEffectWidgetEntry> EffectEntry = GameplayEffectWidgetEntries[Key];
-			if (EffectEntry.IsValid())
+		if (EffectEntry.IsValid())
+		{
+			EffectEntry->SetValue(EffectHandle, ASC);
+			EffectEntry->SetVisibility(ESlateVisibility::Visible);
+			if (EffectEntry->GetParent() != Hb_GameplayEffects)
 			{
-				EffectEntry->SetValue(EffectHandle, ASC);
-				EffectEntry->SetVisibility(ESlateVisibility::Visible);
 				Hb_GameplayEffects->AddChild(EffectEntry.Get());
 			}
 		}
 	}
 
-	// Remove invalid entries
-	TArray<FGameplayEffectEntryKey> KeysToRemove;
-	for (TPair<FGameplayEffectEntryKey, TWeakObjectPtr<UGameplayEffectWidgetEntry>>& Entry : GameplayEffectWidgetEntries)
+	// Remove entries of this player's effects that are no longer active
+	for (auto It = GameplayEffectWidgetEntries.CreateIterator(); It; ++It)
 	{
-		if (!ValidKeys.Contains(Entry.Key))
+		if (It->Key.ASC == ASC && !ValidKeys.Contains(It->Key))
 		{
-			KeysToRemove.Add(Entry.Key);
+			if (It->Value.IsValid())
+			{
+				It->Value->RemoveFromParent();
+			}
+			It.RemoveCurrent();
 		}
 	}
-
-	for (const FGameplayEffectEntryKey& KeyToRemove : KeysToRemove)
-	{
-		GameplayEffectWidgetEntries.Remove(KeyToRemove);
-	}
 }
-
@@ -16,6 +16,7 @@ class UPowerUpWidgetEntry;
 class UGameplayEffectWidgetEntry;
 class UHorizontalBox;
 class UAbilitySystemComponent;
+class AAccelByteWarsPlayerState;
 struct FActiveGameplayEffectHandle;
 
 USTRUCT()
@@ -87,13 +88,14 @@ private:
 	TMap<int32, TWeakObjectPtr<UPowerUpWidgetEntry>> PowerUpWidgetEntries;
 	TMap<FGameplayEffectEntryKey, TWeakObjectPtr<UGameplayEffectWidgetEntry>> GameplayEffectWidgetEntries;
 
-	// Delegate handle for GameState team changes
-	FDelegateHandle GameStateTeamChangedHandle;
+	// Delegate handle for GameState player gameplay effects changes
+	FDelegateHandle PlayerGameplayEffectsChangedHandle;
 
 	// Current team data
 	FGameplayTeamData CurrentTeam;
 
 	// Gameplay effect management functions
 	void RefreshGameplayEffectWidgets();
-	void OnTeamDataChanged();
+	void RefreshPlayerGameplayEffectWidgets(AAccelByteWarsPlayerState* PlayerState);
+	void OnPlayerGameplayEffectsChanged(APlayerState* PlayerState);
 };
@@ -27,6 +27,20 @@ void AccelByteWars2DProbabilityDistribution::IterateGrid(TFunctionRef<void(int32
 	}
 }
 
+void AccelByteWars2DProbabilityDistribution::ApplyExclusion(const FVector2D& Location)
+{
+	IterateGrid([this, Location](int32 Col, int32 Row, float& Value) {
+		const float DistToCell = FVector2D::Distance(GetCellLocation(Col, Row), Location);
+		Value = FMath::Min(Value, FMath::Max(0.0f, DistToCell));
+	});
+}
+
+float AccelByteWars2DProbabilityDistribution::GetExclusionValue(int32 CellIndex, const FVector2D& Location) const
+{
+	const float DistToCell = FVector2D::Distance(GetCellLocation(CellIndex % NumCols, CellIndex / NumCols), Location);
+	return FMath::Max(0.0f, DistToCell);
+}
+
 FVector2D AccelByteWars2DProbabilityDistribution::GetCellLocation(int32 Col, int32 Row) const
 {
 	return CellSize * FVector2D(Col, Row) + MinPosition + (CellSize * 0.5f);
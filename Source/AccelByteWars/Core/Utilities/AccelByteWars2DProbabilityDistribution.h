@@ -20,6 +20,20 @@ public:
 	FVector2D GetCellLocation(int32 Col, int32 Row) const;
 	bool FindGoodPosition(FVector2D& OutLocation, float Radius);
 
+	int32 GetNumCells() const { return Grid.Num(); }
+	float GetCellValue(int32 CellIndex) const { return Grid[CellIndex]; }
+	void SetCellValue(int32 CellIndex, float Value) { Grid[CellIndex] = Value; }
+
+	/**
+	 * @brief Lower the value of every cell to its distance from the location, so positions near it are less likely to be picked.
+	 */
+	void ApplyExclusion(const FVector2D& Location);
+
+	/**
+	 * @brief The value ApplyExclusion would lower the cell to, so a single cell can be updated on its own.
+	 */
+	float GetExclusionValue(int32 CellIndex, const FVector2D& Location) const;
+
 private:
 	int32 NumRows = 0;
 	int32 NumCols = 0;
@@ -0,0 +1,325 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Core/Utilities/AccelByteWarsImageCache.h"
+#include "Core/Utilities/AccelByteWarsUtilityLog.h"
+#include "Async/Async.h"
+#include "Engine/AssetManager.h"
+#include "Engine/Texture2D.h"
+#include "Engine/StreamableManager.h"
+#include "IImageWrapperModule.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+
+TMap<FString, FAccelByteWarsImageCache::FCachedImage> FAccelByteWarsImageCache::CachedImages;
+TArray<FString> FAccelByteWarsImageCache::CachedImageOrder;
+TMap<FString, FAccelByteWarsImageCache::FPendingImage> FAccelByteWarsImageCache::PendingImages;
+int32 FAccelByteWarsImageCache::LastRequestId = 0;
+int32 FAccelByteWarsImageCache::FirstValidLoadId = 0;
+
+FCacheBrush FAccelByteWarsImageCache::FindCachedImage(const FString& ImageUrl)
+{
+	const FCachedImage* CachedImage = CachedImages.Find(ImageUrl);
+	if (!CachedImage || !CachedImage->Texture.IsValid())
+	{
+		return nullptr;
+	}
+
+	// Mark as the most recently requested.
+	CachedImageOrder.Remove(ImageUrl);
+	CachedImageOrder.Add(ImageUrl);
+
+	return CachedImage->Brush;
+}
+
+int32 FAccelByteWarsImageCache::RequestImage(const FString& ImageUrl, const FOnImageReceived& OnReceived)
+{
+	check(IsInGameThread());
+
+	if (ImageUrl.IsEmpty())
+	{
+		OnReceived.ExecuteIfBound(nullptr);
+		return INDEX_NONE;
+	}
+
+	if (const FCacheBrush CachedBrush = FindCachedImage(ImageUrl))
+	{
+		OnReceived.ExecuteIfBound(CachedBrush);
+		return INDEX_NONE;
+	}
+
+	const int32 RequestId = ++LastRequestId;
+
+	// Join the load that is already in progress.
+	if (FPendingImage* PendingImage = PendingImages.Find(ImageUrl))
+	{
+		PendingImage->Callbacks.Add(TPair<int32, FOnImageReceived>(RequestId, OnReceived));
+		return RequestId;
+	}
+
+	FModuleManager::LoadModuleChecked<IImageWrapperModule>("ImageWrapper");
+
+	FPendingImage& PendingImage = PendingImages.Add(ImageUrl);
+	PendingImage.LoadId = RequestId;
+	PendingImage.Callbacks.Add(TPair<int32, FOnImageReceived>(RequestId, OnReceived));
+
+	if (FPackageName::IsValidObjectPath(ImageUrl))
+	{
+		LoadFromAsset(ImageUrl, RequestId);
+	}
+	else
+	{
+		LoadFromDisk(ImageUrl, RequestId);
+	}
+
+	return RequestId;
+}
+
+void FAccelByteWarsImageCache::CancelImageRequest(const FString& ImageUrl, const int32 RequestId)
+{
+	FPendingImage* PendingImage = PendingImages.Find(ImageUrl);
+	if (!PendingImage || RequestId == INDEX_NONE)
+	{
+		return;
+	}
+
+	PendingImage->Callbacks.RemoveAll([RequestId](const TPair<int32, FOnImageReceived>& Callback)
+	{
+		return Callback.Key == RequestId;
+	});
+
+	// Only the network request can be cancelled, background decoding still completes and fills the cache.
+	if (PendingImage->Callbacks.IsEmpty() && PendingImage->HttpRequest.IsValid())
+	{
+		const FHttpRequestPtr HttpRequest = PendingImage->HttpRequest;
+		PendingImages.Remove(ImageUrl);
+		HttpRequest->CancelRequest();
+	}
+}
+
+void FAccelByteWarsImageCache::ClearCache()
+{
+	check(IsInGameThread());
+
+	FirstValidLoadId = LastRequestId + 1;
+	CachedImages.Empty();
+	CachedImageOrder.Empty();
+
+	// Empty the pending images first, cancelling a load may complete it right away.
+	const TMap<FString, FPendingImage> CancelledImages = MoveTemp(PendingImages);
+	PendingImages.Reset();
+
+	for (const TPair<FString, FPendingImage>& CancelledImage : CancelledImages)
+	{
+		if (CancelledImage.Value.HttpRequest.IsValid())
+		{
+			CancelledImage.Value.HttpRequest->CancelRequest();
+		}
+
+		if (CancelledImage.Value.StreamableHandle.IsValid())
+		{
+			CancelledImage.Value.StreamableHandle->CancelHandle();
+		}
+	}
+}
+
+void FAccelByteWarsImageCache::LoadFromAsset(const FString& ImageUrl, const int32 LoadId)
+{
+	// The delegate is executed immediately if the asset is already loaded, so don't hold the pending image across the call.
+	const TSharedPtr<FStreamableHandle> StreamableHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		FSoftObjectPath(ImageUrl),
+		FStreamableDelegate::CreateLambda([ImageUrl, LoadId]()
+		{
+			UTexture2D* Texture = Cast<UTexture2D>(FSoftObjectPath(ImageUrl).ResolveObject());
+			CompleteRequest(ImageUrl, LoadId, Texture);
+		}));
+
+	if (!StreamableHandle.IsValid())
+	{
+		CompleteRequest(ImageUrl, LoadId, nullptr);
+		return;
+	}
+
+	if (FPendingImage* PendingImage = PendingImages.Find(ImageUrl); PendingImage && PendingImage->LoadId == LoadId)
+	{
+		PendingImage->StreamableHandle = StreamableHandle;
+	}
+}
+
+void FAccelByteWarsImageCache::LoadFromDisk(const FString& ImageUrl, const int32 LoadId)
+{
+	const FString CachePath = GetDiskCachePath(ImageUrl);
+	Async(EAsyncExecution::ThreadPool, [ImageUrl, LoadId, CachePath]()
+	{
+		TArray<uint8> Compressed;
+		TArray<uint8> RawBGRA;
+		int32 Width = 0, Height = 0;
+		const bool bIsLoaded = FFileHelper::LoadFileToArray(Compressed, *CachePath, FILEREAD_Silent) && DecodeImage(Compressed, RawBGRA, Width, Height);
+
+		AsyncTask(ENamedThreads::GameThread, [ImageUrl, LoadId, RawBGRA = MoveTemp(RawBGRA), Width, Height, bIsLoaded]()
+		{
+			if (!bIsLoaded)
+			{
+				// Not cached on disk yet, continue to download the image if anyone still waits for it.
+				const FPendingImage* PendingImage = PendingImages.Find(ImageUrl);
+				if (!PendingImage || PendingImage->LoadId != LoadId)
+				{
+					return;
+				}
+
+				if (PendingImage->Callbacks.IsEmpty())
+				{
+					PendingImages.Remove(ImageUrl);
+					return;
+				}
+
+				LoadFromNetwork(ImageUrl, LoadId);
+				return;
+			}
+
+			CompleteRequest(ImageUrl, LoadId, CreateTexture(RawBGRA, Width, Height));
+		});
+	});
+}
+
+void FAccelByteWarsImageCache::LoadFromNetwork(const FString& ImageUrl, const int32 LoadId)
+{
+	const FHttpRequestPtr Request = FHttpModule::Get().CreateRequest();
+	Request->SetVerb("GET");
+	Request->SetURL(ImageUrl);
+
+	Request->OnProcessRequestComplete().BindLambda(
+		[ImageUrl, LoadId](FHttpRequestPtr Req, FHttpResponsePtr Response, bool bSuccess)
+		{
+			if (!bSuccess || !Response.IsValid() || !EHttpResponseCodes::IsOk(Response->GetResponseCode()))
+			{
+				CompleteRequest(ImageUrl, LoadId, nullptr);
+				return;
+			}
+
+			// Decode and save the image to disk in the background, then create the texture back on the game thread.
+			const FString CachePath = GetDiskCachePath(ImageUrl);
+			Async(EAsyncExecution::ThreadPool, [ImageUrl, LoadId, CachePath, Compressed = Response->GetContent()]()
+			{
+				TArray<uint8> RawBGRA;
+				int32 Width = 0, Height = 0;
+				const bool bIsDecoded = DecodeImage(Compressed, RawBGRA, Width, Height);
+				if (bIsDecoded)
+				{
+					FFileHelper::SaveArrayToFile(Compressed, *CachePath);
+				}
+
+				AsyncTask(ENamedThreads::GameThread, [ImageUrl, LoadId, RawBGRA = MoveTemp(RawBGRA), Width, Height, bIsDecoded]()
+				{
+					CompleteRequest(ImageUrl, LoadId, bIsDecoded ? CreateTexture(RawBGRA, Width, Height) : nullptr);
+				});
+			});
+		});
+
+	if (FPendingImage* PendingImage = PendingImages.Find(ImageUrl))
+	{
+		PendingImage->HttpRequest = Request;
+	}
+
+	Request->ProcessRequest();
+}
+
+bool FAccelByteWarsImageCache::DecodeImage(const TArray<uint8>& Compressed, TArray<uint8>& OutRawBGRA, int32& OutWidth, int32& OutHeight)
+{
+	if (Compressed.IsEmpty())
+	{
+		return false;
+	}
+
+	// The module is loaded on the game thread before any decoding starts.
+	IImageWrapperModule& Module = FModuleManager::GetModuleChecked<IImageWrapperModule>("ImageWrapper");
+	const EImageFormat Format = Module.DetectImageFormat(Compressed.GetData(), Compressed.Num());
+	if (Format == EImageFormat::Invalid)
+	{
+		return false;
+	}
+
+	const TSharedPtr<IImageWrapper> Wrapper = Module.CreateImageWrapper(Format);
+	if (!Wrapper.IsValid() || !Wrapper->SetCompressed(Compressed.GetData(), Compressed.Num()) || !Wrapper->GetRaw(ERGBFormat::BGRA, 8, OutRawBGRA))
+	{
+		return false;
+	}
+
+	OutWidth = Wrapper->GetWidth();
+	OutHeight = Wrapper->GetHeight();
+	return true;
+}
+
+UTexture2D* FAccelByteWarsImageCache::CreateTexture(const TArray<uint8>& RawBGRA, const int32 Width, const int32 Height)
+{
+	UTexture2D* Texture = UTexture2D::CreateTransient(Width, Height, PF_B8G8R8A8);
+	if (!Texture)
+	{
+		return nullptr;
+	}
+
+	// Write texture data.
+	void* TexData = Texture->GetPlatformData()->Mips[0].BulkData.Lock(LOCK_READ_WRITE);
+	FMemory::Memcpy(TexData, RawBGRA.GetData(), RawBGRA.Num());
+	Texture->GetPlatformData()->Mips[0].BulkData.Unlock();
+	Texture->UpdateResource();
+
+	return Texture;
+}
+
+void FAccelByteWarsImageCache::CompleteRequest(const FString& ImageUrl, const int32 LoadId, UTexture2D* Texture)
+{
+	FCacheBrush Brush = nullptr;
+	if (Texture && LoadId >= FirstValidLoadId)
+	{
+		// Create brush from texture.
+		Brush = MakeShared<FSlateBrush>();
+		Brush->SetResourceObject(Texture);
+		Brush->ImageSize = FVector2D(Texture->GetSizeX(), Texture->GetSizeY());
+
+		AddToMemoryCache(ImageUrl, FCachedImage{ Brush, TStrongObjectPtr<UTexture2D>(Texture) });
+	}
+
+	// The load might have been cancelled and replaced by a newer one.
+	const FPendingImage* PendingImage = PendingImages.Find(ImageUrl);
+	if (!PendingImage || PendingImage->LoadId != LoadId)
+	{
+		return;
+	}
+
+	const TArray<TPair<int32, FOnImageReceived>> Callbacks = PendingImage->Callbacks;
+	PendingImages.Remove(ImageUrl);
+
+	for (const TPair<int32, FOnImageReceived>& Callback : Callbacks)
+	{
+		Callback.Value.ExecuteIfBound(Brush);
+	}
+}
+
+void FAccelByteWarsImageCache::AddToMemoryCache(const FString& ImageUrl, const FCachedImage& Image)
+{
+	CachedImages.Add(ImageUrl, Image);
+	CachedImageOrder.Remove(ImageUrl);
+	CachedImageOrder.Add(ImageUrl);
+
+	while (CachedImageOrder.Num() > IMAGE_CACHE_MEMORY_CAPACITY)
+	{
+		CachedImages.Remove(CachedImageOrder[0]);
+		CachedImageOrder.RemoveAt(0);
+	}
+}
+
+FString FAccelByteWarsImageCache::GetDiskCachePath(const FString& ImageUrl)
+{
+	FString CachePath = TEXT("");
+#if (defined(PLATFORM_PS4) && PLATFORM_PS4) || (defined(PLATFORM_PS5) && PLATFORM_PS5)
+	CachePath = FPaths::ProjectPersistentDownloadDir();
+#else
+	CachePath = FPaths::ProjectSavedDir();
+#endif
+	return CachePath / TEXT("Caches") / FBase64::Encode(ImageUrl);
+}
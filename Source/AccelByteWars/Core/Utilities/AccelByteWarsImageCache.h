@@ -0,0 +1,82 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Core/Utilities/AccelByteWarsUtility.h"
+
+struct FStreamableHandle;
+class UTexture2D;
+
+// Maximum number of decoded images kept in memory, the least recently requested ones are released first.
+#define IMAGE_CACHE_MEMORY_CAPACITY 256
+
+/**
+ * @brief Shared cache of the images loaded by URL, e.g. the player avatars.
+ * Images are resolved from memory first, then from the disk cache, then from the network.
+ * Decoding runs on a background thread, and concurrent requests of the same image share one load.
+ */
+class ACCELBYTEWARS_API FAccelByteWarsImageCache
+{
+public:
+	/**
+	 * @brief Get the image from the memory cache without loading it.
+	 */
+	static FCacheBrush FindCachedImage(const FString& ImageUrl);
+
+	/**
+	 * @brief Resolve the image of the URL. The callback is executed on the game thread with an invalid brush if the image can't be loaded.
+	 * @return Id to cancel the request with, or INDEX_NONE if the callback was already executed.
+	 */
+	static int32 RequestImage(const FString& ImageUrl, const FOnImageReceived& OnReceived);
+
+	/**
+	 * @brief Stop the callback of the request from being executed. The network request is cancelled if no one else waits for the image.
+	 */
+	static void CancelImageRequest(const FString& ImageUrl, const int32 RequestId);
+
+	/**
+	 * @brief Release the cached textures and drop the pending requests. Called on game instance shutdown, so the textures
+	 * don't outlive a PIE session and are released before the engine tears down the object system.
+	 */
+	static void ClearCache();
+
+private:
+	struct FCachedImage
+	{
+		FCacheBrush Brush;
+		TStrongObjectPtr<UTexture2D> Texture;
+	};
+
+	struct FPendingImage
+	{
+		int32 LoadId = INDEX_NONE;
+		TArray<TPair<int32, FOnImageReceived>> Callbacks;
+		FHttpRequestPtr HttpRequest;
+		TSharedPtr<FStreamableHandle> StreamableHandle;
+	};
+
+	static void LoadFromAsset(const FString& ImageUrl, const int32 LoadId);
+	static void LoadFromDisk(const FString& ImageUrl, const int32 LoadId);
+	static void LoadFromNetwork(const FString& ImageUrl, const int32 LoadId);
+
+	/** @brief Decode a compressed image to raw BGRA pixels, safe to be called from any thread. */
+	static bool DecodeImage(const TArray<uint8>& Compressed, TArray<uint8>& OutRawBGRA, int32& OutWidth, int32& OutHeight);
+	static UTexture2D* CreateTexture(const TArray<uint8>& RawBGRA, const int32 Width, const int32 Height);
+
+	static void CompleteRequest(const FString& ImageUrl, const int32 LoadId, UTexture2D* Texture);
+	static void AddToMemoryCache(const FString& ImageUrl, const FCachedImage& Image);
+	static FString GetDiskCachePath(const FString& ImageUrl);
+
+	static TMap<FString, FCachedImage> CachedImages;
+	static TArray<FString> CachedImageOrder;
+	static TMap<FString, FPendingImage> PendingImages;
+	static int32 LastRequestId;
+
+	// Loads started before the last ClearCache must not fill the cache again when they complete.
+	static int32 FirstValidLoadId;
+};
@@ -5,6 +5,7 @@
 #include "AccelByteWarsUtility.h"
 #include "Blueprint/WidgetBlueprintLibrary.h"
 #include "Core/Player/AccelByteWarsBotController.h"
+#include "Core/UI/AccelByteWarsWidgetRegistry.h"
 #include "Runtime/ImageWrapper/Public/IImageWrapperModule.h"
 #include "Runtime/Online/HTTP/Public/Http.h"
 #include "Runtime/Engine/Classes/GameFramework/PlayerState.h"
@@ -202,10 +203,15 @@ TArray<UUserWidget*> AccelByteWarsUtility::FindWidgetsOnTheScreen(
 		return FoundWidgets;
 	}
 
-	UWidgetBlueprintLibrary::GetAllWidgetsOfClass(Context, FoundWidgets, WidgetClass.Get(), bTopLevelOnly);
-	FoundWidgets.RemoveAll([WidgetName](const UUserWidget* FoundWidget)
+	// Every user widget is registered when it is created, so a widget missing from the registry is not on the screen.
+	if (!FAccelByteWarsWidgetRegistry::FindWidgets(FName(*WidgetName), WidgetClass.Get(), Context, FoundWidgets))
 	{
-		return !FoundWidget || !FoundWidget->GetName().Equals(WidgetName) || !FoundWidget->IsVisible();
+		return FoundWidgets;
+	}
+
+	FoundWidgets.RemoveAll([bTopLevelOnly](const UUserWidget* FoundWidget)
+	{
+		return !FoundWidget || !FoundWidget->IsVisible() || (bTopLevelOnly && !FoundWidget->IsInViewport());
 	});
 
 	return FoundWidgets;
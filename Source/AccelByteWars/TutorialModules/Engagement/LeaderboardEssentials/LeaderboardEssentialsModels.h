@@ -29,6 +29,21 @@ public:
 };
 // @@@SNIPEND
 
+// Ranking data kept by the leaderboard page cache to rebuild the ranking objects without reading the leaderboard again.
+struct FLeaderboardRankData
+{
+	FUniqueNetIdRepl UserId;
+	int32 Rank = -1;
+	FString DisplayName;
+	float Score = 0.0f;
+};
+
+// How long the cached leaderboard rankings are served before they are read again, in seconds.
+#define LEADERBOARD_PAGE_CACHE_TTL 60.0
+
+// How long a rankings read may take before it is completed as failed, so the queued reads are not stuck behind it, in seconds.
+#define LEADERBOARD_PAGE_READ_TIMEOUT 15.0f
+
 #define DEFAULT_LEADERBOARD_DISPLAY_NAME NSLOCTEXT("AccelByteWars", "Player-{0}", "Player-{0}")
 #define RANKED_MESSAGE NSLOCTEXT("AccelByteWars", "Your Rank", "Your Rank")
 #define UNRANKED_MESSAGE NSLOCTEXT("AccelByteWars", "You Are Unranked", "You Are Unranked")
@@ -0,0 +1,199 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Engagement/LeaderboardEssentials/LeaderboardPageCache.h"
+#include "LeaderboardEssentialsLog.h"
+
+FLeaderboardPageCache::~FLeaderboardPageCache()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(ReadTimeoutHandle);
+}
+
+FString FLeaderboardPageCache::MakePageKey(const FString& LeaderboardCode, const FString& CycleId, const int32 PageIndex, const int32 PageSize)
+{
+	return FString::Printf(TEXT("%s;%s;page;%d;%d"), *LeaderboardCode, *CycleId, PageIndex, PageSize);
+}
+
+FString FLeaderboardPageCache::MakePlayerRankKey(const FString& LeaderboardCode, const FString& CycleId, const FUniqueNetIdRepl& UserId)
+{
+	return FString::Printf(TEXT("%s;%s;player;%s"), *LeaderboardCode, *CycleId, *UserId.ToString());
+}
+
+void FLeaderboardPageCache::GetRankings(const FString& Key, const bool bIsPrefetch, const FReadRankings& ReadRankings, const FOnGetLeaderboardRankingComplete& OnComplete)
+{
+	// Serve the rankings from the cache if they are not expired yet.
+	if (IsCached(Key))
+	{
+		if (!bIsPrefetch)
+		{
+			UE_LOG_LEADERBOARD_ESSENTIALS(Log, TEXT("Serving cached leaderboard rankings: %s"), *Key);
+			OnComplete.ExecuteIfBound(true, CreateRankObjects(CachedRankings[Key].Rankings));
+		}
+		return;
+	}
+
+	// Join the read of the same rankings if it is already requested.
+	if (InFlightRead.IsSet() && InFlightRead->Key.Equals(Key))
+	{
+		InFlightRead->OnCompletes.Add(OnComplete);
+		return;
+	}
+
+	const int32 PendingIndex = PendingReads.IndexOfByPredicate([&Key](const FRankingsRead& Read) { return Read.Key.Equals(Key); });
+	if (PendingReads.IsValidIndex(PendingIndex))
+	{
+		PendingReads[PendingIndex].OnCompletes.Add(OnComplete);
+
+		// The player is now waiting for the prefetched rankings, move them ahead of the other prefetch reads.
+		if (PendingReads[PendingIndex].bIsPrefetch && !bIsPrefetch)
+		{
+			FRankingsRead PromotedRead = MoveTemp(PendingReads[PendingIndex]);
+			PendingReads.RemoveAt(PendingIndex);
+			PromotedRead.bIsPrefetch = false;
+			QueueRead(MoveTemp(PromotedRead));
+		}
+		return;
+	}
+
+	FRankingsRead NewRead;
+	NewRead.Key = Key;
+	NewRead.bIsPrefetch = bIsPrefetch;
+	NewRead.ReadRankings = ReadRankings;
+	NewRead.OnCompletes.Add(OnComplete);
+	QueueRead(MoveTemp(NewRead));
+
+	ReadNextRankings();
+}
+
+bool FLeaderboardPageCache::IsCached(const FString& Key) const
+{
+	const FCachedRankings* Cached = CachedRankings.Find(Key);
+	return Cached && (FPlatformTime::Seconds() - Cached->CachedTime) < LEADERBOARD_PAGE_CACHE_TTL;
+}
+
+const FString* FLeaderboardPageCache::FindDisplayName(const FUniqueNetIdRepl& UserId) const
+{
+	return DisplayNames.Find(UserId.ToString());
+}
+
+void FLeaderboardPageCache::AddDisplayName(const FUniqueNetIdRepl& UserId, const FString& DisplayName)
+{
+	DisplayNames.Add(UserId.ToString(), DisplayName);
+}
+
+TArray<FUniqueNetIdRef> FLeaderboardPageCache::GetUnresolvedUserIds(const TArray<FUniqueNetIdRef>& UserIds) const
+{
+	return UserIds.FilterByPredicate([this](const FUniqueNetIdRef& UserId)
+	{
+		return !DisplayNames.Contains(UserId->ToString());
+	});
+}
+
+void FLeaderboardPageCache::QueueRead(FRankingsRead&& Read)
+{
+	// Prefetch reads go to the back of the queue, the others go before the first prefetch read.
+	int32 InsertIndex = PendingReads.Num();
+	if (!Read.bIsPrefetch)
+	{
+		const int32 PrefetchIndex = PendingReads.IndexOfByPredicate([](const FRankingsRead& PendingRead) { return PendingRead.bIsPrefetch; });
+		if (PrefetchIndex != INDEX_NONE)
+		{
+			InsertIndex = PrefetchIndex;
+		}
+	}
+
+	PendingReads.Insert(MoveTemp(Read), InsertIndex);
+}
+
+void FLeaderboardPageCache::ReadNextRankings()
+{
+	if (InFlightRead.IsSet() || PendingReads.IsEmpty())
+	{
+		return;
+	}
+
+	InFlightRead = MoveTemp(PendingReads[0]);
+	PendingReads.RemoveAt(0);
+
+	// Complete the read as failed if its completion never arrives, so the next reads can run.
+	const uint32 ReadId = ++NextReadId;
+	InFlightRead->ReadId = ReadId;
+	ReadTimeoutHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateSP(this, &FLeaderboardPageCache::OnReadRankingsTimeout, ReadId),
+		LEADERBOARD_PAGE_READ_TIMEOUT);
+
+	// Keep a copy, since the read may complete right away and reset the in-flight read.
+	const FReadRankings ReadRankings = InFlightRead->ReadRankings;
+	ReadRankings(FOnGetLeaderboardRankingComplete::CreateSP(this, &FLeaderboardPageCache::OnReadRankingsComplete, ReadId));
+}
+
+void FLeaderboardPageCache::OnReadRankingsComplete(bool bWasSuccessful, const TArray<ULeaderboardRank*> Rankings, const uint32 ReadId)
+{
+	// Ignore the late completion of a read that already timed out.
+	if (!InFlightRead.IsSet() || InFlightRead->ReadId != ReadId)
+	{
+		return;
+	}
+
+	FTSTicker::GetCoreTicker().RemoveTicker(ReadTimeoutHandle);
+	ReadTimeoutHandle.Reset();
+
+	FRankingsRead CompletedRead = MoveTemp(InFlightRead.GetValue());
+	InFlightRead.Reset();
+
+	if (bWasSuccessful)
+	{
+		FCachedRankings& Cached = CachedRankings.FindOrAdd(CompletedRead.Key);
+		Cached.Rankings.Reset(Rankings.Num());
+		for (const ULeaderboardRank* Ranking : Rankings)
+		{
+			if (!Ranking)
+			{
+				continue;
+			}
+
+			FLeaderboardRankData& RankData = Cached.Rankings.AddDefaulted_GetRef();
+			RankData.UserId = Ranking->UserId;
+			RankData.Rank = Ranking->Rank;
+			RankData.DisplayName = Ranking->DisplayName;
+			RankData.Score = Ranking->Score;
+		}
+		Cached.CachedTime = FPlatformTime::Seconds();
+	}
+
+	for (const FOnGetLeaderboardRankingComplete& OnComplete : CompletedRead.OnCompletes)
+	{
+		OnComplete.ExecuteIfBound(bWasSuccessful, Rankings);
+	}
+
+	ReadNextRankings();
+}
+
+bool FLeaderboardPageCache::OnReadRankingsTimeout(float DeltaTime, const uint32 ReadId)
+{
+	// The ticker is removed by returning false.
+	ReadTimeoutHandle.Reset();
+
+	if (InFlightRead.IsSet() && InFlightRead->ReadId == ReadId)
+	{
+		UE_LOG_LEADERBOARD_ESSENTIALS(Warning, TEXT("Leaderboard rankings read timed out: %s"), *InFlightRead->Key);
+		OnReadRankingsComplete(false, TArray<ULeaderboardRank*>(), ReadId);
+	}
+
+	return false;
+}
+
+TArray<ULeaderboardRank*> FLeaderboardPageCache::CreateRankObjects(const TArray<FLeaderboardRankData>& Rankings)
+{
+	TArray<ULeaderboardRank*> RankObjects;
+	RankObjects.Reserve(Rankings.Num());
+	for (const FLeaderboardRankData& RankData : Rankings)
+	{
+		ULeaderboardRank* NewRanking = NewObject<ULeaderboardRank>();
+		NewRanking->Init(RankData.UserId, RankData.Rank, RankData.DisplayName, RankData.Score);
+		RankObjects.Add(NewRanking);
+	}
+
+	return RankObjects;
+}
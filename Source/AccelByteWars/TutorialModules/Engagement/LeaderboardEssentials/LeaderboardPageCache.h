@@ -0,0 +1,74 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "LeaderboardEssentialsModels.h"
+
+/**
+ * @brief Leaderboard rankings cached by page (or by player) and the display names of the ranked players.
+ * Reads that miss the cache are queued and run one at a time, since the leaderboard and user info
+ * queries only keep track of a single request completion at a time. A read that doesn't complete
+ * within LEADERBOARD_PAGE_READ_TIMEOUT is completed as failed.
+ */
+class ACCELBYTEWARS_API FLeaderboardPageCache : public TSharedFromThis<FLeaderboardPageCache>
+{
+public:
+	/** Starts the actual rankings read. It must execute OnReadComplete once the read is done. */
+	typedef TFunction<void(const FOnGetLeaderboardRankingComplete& /*OnReadComplete*/)> FReadRankings;
+
+	~FLeaderboardPageCache();
+
+	static FString MakePageKey(const FString& LeaderboardCode, const FString& CycleId, const int32 PageIndex, const int32 PageSize);
+	static FString MakePlayerRankKey(const FString& LeaderboardCode, const FString& CycleId, const FUniqueNetIdRepl& UserId);
+
+	/**
+	 * @brief Get rankings from the cache if they are not expired yet, otherwise queue a read to refresh them.
+	 * @param Key The cache key of the rankings, see MakePageKey() and MakePlayerRankKey().
+	 * @param bIsPrefetch Prefetch reads run after the other queued reads and are skipped if the rankings are still cached.
+	 * @param ReadRankings Function to read the rankings if they are not cached.
+	 */
+	void GetRankings(const FString& Key, const bool bIsPrefetch, const FReadRankings& ReadRankings, const FOnGetLeaderboardRankingComplete& OnComplete);
+
+	bool IsCached(const FString& Key) const;
+
+	const FString* FindDisplayName(const FUniqueNetIdRepl& UserId) const;
+	void AddDisplayName(const FUniqueNetIdRepl& UserId, const FString& DisplayName);
+
+	/** Returns the user ids whose display names are not resolved yet. */
+	TArray<FUniqueNetIdRef> GetUnresolvedUserIds(const TArray<FUniqueNetIdRef>& UserIds) const;
+
+private:
+	struct FCachedRankings
+	{
+		TArray<FLeaderboardRankData> Rankings;
+		double CachedTime = 0.0;
+	};
+
+	struct FRankingsRead
+	{
+		uint32 ReadId = 0;
+		FString Key;
+		bool bIsPrefetch = false;
+		FReadRankings ReadRankings;
+		TArray<FOnGetLeaderboardRankingComplete> OnCompletes;
+	};
+
+	void QueueRead(FRankingsRead&& Read);
+	void ReadNextRankings();
+	void OnReadRankingsComplete(bool bWasSuccessful, const TArray<ULeaderboardRank*> Rankings, const uint32 ReadId);
+	bool OnReadRankingsTimeout(float DeltaTime, const uint32 ReadId);
+
+	static TArray<ULeaderboardRank*> CreateRankObjects(const TArray<FLeaderboardRankData>& Rankings);
+
+	TMap<FString, FCachedRankings> CachedRankings;
+	TMap<FString, FString> DisplayNames;
+
+	TArray<FRankingsRead> PendingReads;
+	TOptional<FRankingsRead> InFlightRead;
+	uint32 NextReadId = 0;
+	FTSTicker::FDelegateHandle ReadTimeoutHandle;
+};
@@ -89,17 +89,8 @@ void ULeaderboardSubsystem::GetRankings(const APlayerController* PC, const FStri
 
 	const int32 LocalUserNum = GetLocalUserNumFromPlayerController(PC);
 
-	FOnlineLeaderboardReadRef LeaderboardObj = MakeShared<FOnlineLeaderboardRead, ESPMode::ThreadSafe>();
-
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 5
-	LeaderboardObj->LeaderboardName = LeaderboardCode;
-#else
-	LeaderboardObj->LeaderboardName = FName(LeaderboardCode);
-#endif
-
-	// Get the leaderboard within the range of 0 to ResultLimit.
-	OnLeaderboardReadCompleteDelegateHandle = LeaderboardInterface->AddOnLeaderboardReadCompleteDelegate_Handle(FOnLeaderboardReadCompleteDelegate::CreateUObject(this, &ThisClass::OnGetRankingsComplete, LocalUserNum, LeaderboardObj, OnComplete));
-	LeaderboardInterface->ReadLeaderboardsAroundRank(0, ResultLimit, LeaderboardObj);
+	// Get the first page of the leaderboard, which is within the range of 0 to ResultLimit.
+	RequestRankingsPage(LocalUserNum, LeaderboardCode, ResultLimit, 0, false, OnComplete);
 }
 // @@@SNIPEND
 
@@ -135,9 +126,18 @@ void ULeaderboardSubsystem::GetPlayerRanking(const APlayerController* PC, const
 	LeaderboardObj->LeaderboardName = FName(LeaderboardCode);
 #endif
 
-	// Get the player's leaderboard ranking.
-	OnLeaderboardReadCompleteDelegateHandle = LeaderboardInterface->AddOnLeaderboardReadCompleteDelegate_Handle(FOnLeaderboardReadCompleteDelegate::CreateUObject(this, &ThisClass::OnGetRankingsComplete, LocalUserNum, LeaderboardObj, OnComplete));
-	LeaderboardInterface->ReadLeaderboards(TArray<FUniqueNetIdRef>{ PlayerNetId->AsShared() }, LeaderboardObj);
+	// Get the player's leaderboard ranking, served from the page cache if it was read recently.
+	PageCache->GetRankings(
+		FLeaderboardPageCache::MakePlayerRankKey(LeaderboardCode, FString(), PlayerNetId),
+		false,
+		[this, LocalUserNum, LeaderboardObj, PlayerNetId](const FOnGetLeaderboardRankingComplete& OnReadComplete)
+		{
+			// Drop the completion delegate of a previous read that timed out, its late completion must not be handled.
+			LeaderboardInterface->ClearOnLeaderboardReadCompleteDelegate_Handle(OnLeaderboardReadCompleteDelegateHandle);
+			OnLeaderboardReadCompleteDelegateHandle = LeaderboardInterface->AddOnLeaderboardReadCompleteDelegate_Handle(FOnLeaderboardReadCompleteDelegate::CreateUObject(this, &ThisClass::OnGetRankingsComplete, LocalUserNum, LeaderboardObj, OnReadComplete));
+			LeaderboardInterface->ReadLeaderboards(TArray<FUniqueNetIdRef>{ PlayerNetId->AsShared() }, LeaderboardObj);
+		},
+		OnComplete);
 }
 // @@@SNIPEND
 
@@ -170,12 +170,20 @@ void ULeaderboardSubsystem::OnGetRankingsComplete(bool bWasSuccessful, const int
 		}
 	}
 
+	// Only query the user information of the members whose display names are not resolved yet.
+	const TArray<FUniqueNetIdRef> UnresolvedMembers = PageCache->GetUnresolvedUserIds(LeaderboardMembers);
+	if (UnresolvedMembers.IsEmpty())
+	{
+		OnQueryUserInfoComplete(FOnlineError::Success(), TArray<TSharedPtr<FUserOnlineAccountAccelByte>>(), LocalUserNum, LeaderboardObj, OnComplete);
+		return;
+	}
+
 	// Query leaderboard members' user information.
 	if (UStartupSubsystem* StartupSubsystem = GetGameInstance()->GetSubsystem<UStartupSubsystem>())
 	{
 		StartupSubsystem->QueryUserInfo(
 			LocalUserNum,
-			LeaderboardMembers,
+			UnresolvedMembers,
 			FOnQueryUsersInfoCompleteDelegate::CreateUObject(this, &ThisClass::OnQueryUserInfoComplete, LocalUserNum, LeaderboardObj, OnComplete));
 	}
 	else
@@ -196,6 +204,7 @@ void ULeaderboardSubsystem::OnQueryUserInfoComplete(
 	if (!ensure(UserInterface))
 	{
 		UE_LOG_LEADERBOARD_ESSENTIALS(Warning, TEXT("Cannot get leaderboard. User Interface is not valid."));
+		OnComplete.ExecuteIfBound(false, TArray<ULeaderboardRank*>());
 		return;
 	}
 
@@ -221,12 +230,22 @@ void ULeaderboardSubsystem::OnQueryUserInfoComplete(
 			continue;
 		}
 
-		// Get the member's display name.
-		const TSharedPtr<FOnlineUser> LeaderboardMember =
-			UserInterface->GetUserInfo(LocalUserNum, Row.PlayerId->AsShared().Get());
-		const FString DisplayName = !LeaderboardMember->GetDisplayName().IsEmpty() ?
-			LeaderboardMember->GetDisplayName() :
-			FText::Format(DEFAULT_LEADERBOARD_DISPLAY_NAME, FText::FromString(Row.NickName.Left(5))).ToString();
+		// Get the member's display name, reusing the one resolved by the previous queries if any.
+		FString DisplayName;
+		if (const FString* ResolvedDisplayName = PageCache->FindDisplayName(Row.PlayerId))
+		{
+			DisplayName = *ResolvedDisplayName;
+		}
+		else if (const TSharedPtr<FOnlineUser> LeaderboardMember = UserInterface->GetUserInfo(LocalUserNum, Row.PlayerId->AsShared().Get()))
+		{
+			DisplayName = LeaderboardMember->GetDisplayName();
+			PageCache->AddDisplayName(Row.PlayerId, DisplayName);
+		}
+
+		if (DisplayName.IsEmpty())
+		{
+			DisplayName = FText::Format(DEFAULT_LEADERBOARD_DISPLAY_NAME, FText::FromString(Row.NickName.Left(5))).ToString();
+		}
 
 		// Get the member's stat value.
 		float Score = 0.0f;
@@ -252,3 +271,58 @@ void ULeaderboardSubsystem::OnQueryUserInfoComplete(
 // @@@SNIPEND
 
 #pragma endregion
+
+#pragma region "Leaderboard Page Cache"
+
+void ULeaderboardSubsystem::GetRankingsPage(const APlayerController* PC, const FString& LeaderboardCode, const int32 ResultLimit, const int32 PageIndex, const FOnGetLeaderboardRankingComplete& OnComplete)
+{
+	if (!ensure(LeaderboardInterface.IsValid()) || !ensure(UserInterface.IsValid()))
+	{
+		UE_LOG_LEADERBOARD_ESSENTIALS(Warning, TEXT("Cannot get leaderboard rankings page. Leaderboard Interface or User Interface is not valid."));
+		OnComplete.ExecuteIfBound(false, TArray<ULeaderboardRank*>());
+		return;
+	}
+
+	if (!ensure(PC) || PageIndex < 0 || ResultLimit <= 0)
+	{
+		UE_LOG_LEADERBOARD_ESSENTIALS(Warning, TEXT("Cannot get leaderboard rankings page. PlayerController is null or the page is invalid."));
+		OnComplete.ExecuteIfBound(false, TArray<ULeaderboardRank*>());
+		return;
+	}
+
+	RequestRankingsPage(GetLocalUserNumFromPlayerController(PC), LeaderboardCode, ResultLimit, PageIndex, false, OnComplete);
+}
+
+void ULeaderboardSubsystem::RequestRankingsPage(const int32 LocalUserNum, const FString& LeaderboardCode, const int32 ResultLimit, const int32 PageIndex, const bool bIsPrefetch, const FOnGetLeaderboardRankingComplete& OnComplete)
+{
+	PageCache->GetRankings(
+		FLeaderboardPageCache::MakePageKey(LeaderboardCode, FString(), PageIndex, ResultLimit),
+		bIsPrefetch,
+		[this, LocalUserNum, LeaderboardCode, ResultLimit, PageIndex](const FOnGetLeaderboardRankingComplete& OnReadComplete)
+		{
+			FOnlineLeaderboardReadRef LeaderboardObj = MakeShared<FOnlineLeaderboardRead, ESPMode::ThreadSafe>();
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 5
+			LeaderboardObj->LeaderboardName = LeaderboardCode;
+#else
+			LeaderboardObj->LeaderboardName = FName(LeaderboardCode);
+#endif
+
+			// Drop the completion delegate of a previous read that timed out, its late completion must not be handled.
+			LeaderboardInterface->ClearOnLeaderboardReadCompleteDelegate_Handle(OnLeaderboardReadCompleteDelegateHandle);
+			OnLeaderboardReadCompleteDelegateHandle = LeaderboardInterface->AddOnLeaderboardReadCompleteDelegate_Handle(FOnLeaderboardReadCompleteDelegate::CreateUObject(this, &ThisClass::OnGetRankingsComplete, LocalUserNum, LeaderboardObj, OnReadComplete));
+			LeaderboardInterface->ReadLeaderboardsAroundRank(PageIndex * ResultLimit, ResultLimit, LeaderboardObj);
+		},
+		FOnGetLeaderboardRankingComplete::CreateWeakLambda(this, [this, LocalUserNum, LeaderboardCode, ResultLimit, PageIndex, bIsPrefetch, OnComplete](bool bWasSuccessful, const TArray<ULeaderboardRank*> Rankings)
+		{
+			OnComplete.ExecuteIfBound(bWasSuccessful, Rankings);
+
+			// A full page means there might be more rankings, prefetch the next page so it is ready when the player scrolls down.
+			if (bWasSuccessful && !bIsPrefetch && Rankings.Num() >= ResultLimit)
+			{
+				RequestRankingsPage(LocalUserNum, LeaderboardCode, ResultLimit, PageIndex + 1, true, FOnGetLeaderboardRankingComplete());
+			}
+		}));
+}
+
+#pragma endregion
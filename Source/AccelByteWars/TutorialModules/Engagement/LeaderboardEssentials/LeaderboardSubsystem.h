@@ -11,6 +11,7 @@
 #include "OnlineLeaderboardInterfaceAccelByte.h"
 #include "LeaderboardEssentialsLog.h"
 #include "LeaderboardEssentialsModels.h"
+#include "LeaderboardPageCache.h"
 #include "TutorialModuleUtilities/StartupSubsystem.h"
 #include "LeaderboardSubsystem.generated.h"
 
@@ -71,4 +72,21 @@ protected:
 
 	FDelegateHandle OnLeaderboardReadCompleteDelegateHandle;
 // @@@SNIPEND
+
+#pragma region "Leaderboard Page Cache"
+public:
+	/**
+	 * @brief Get a page of rankings of a leaderboard. Pages are cached and the next page is prefetched in the background.
+	 * @param PC PlayerController to determine who's credential is going to be used for the API call.
+	 * @param LeaderboardCode The leaderboard code (id) to be read.
+	 * @param ResultLimit The maximum limit of leaderboard entries of a page.
+	 * @param PageIndex The zero-based index of the page to be read.
+	 */
+	void GetRankingsPage(const APlayerController* PC, const FString& LeaderboardCode, const int32 ResultLimit, const int32 PageIndex, const FOnGetLeaderboardRankingComplete& OnComplete = FOnGetLeaderboardRankingComplete());
+
+protected:
+	void RequestRankingsPage(const int32 LocalUserNum, const FString& LeaderboardCode, const int32 ResultLimit, const int32 PageIndex, const bool bIsPrefetch, const FOnGetLeaderboardRankingComplete& OnComplete);
+
+	TSharedRef<FLeaderboardPageCache> PageCache = MakeShared<FLeaderboardPageCache>();
+#pragma endregion
 };
@@ -18,6 +18,9 @@ void ULeaderboardAllTimeWidget::NativeConstruct()
 
 	LeaderboardSubsystem = GameInstance->GetSubsystem<ULeaderboardSubsystem>();
 	ensure(LeaderboardSubsystem);
+
+	Lv_Leaderboard->OnListViewScrolled().RemoveAll(this);
+	Lv_Leaderboard->OnListViewScrolled().AddUObject(this, &ThisClass::OnLeaderboardScrolled);
 }
 
 // @@@SNIPSTART LeaderboardAllTimeWidget.cpp-NativeOnActivated
@@ -131,3 +134,46 @@ void ULeaderboardAllTimeWidget::DisplayPlayerRank(const ULeaderboardRank* Player
 	PlayerRankPanel->SetVisibility(ESlateVisibility::HitTestInvisible);
 }
 // @@@SNIPEND
+
+#pragma region "Ranking Pages"
+
+void ULeaderboardAllTimeWidget::OnLeaderboardScrolled(float ItemOffset, float DistanceRemaining)
+{
+	// If every loaded page is full, there might be more rankings to load.
+	const int32 NumLoadedItems = Lv_Leaderboard->GetNumItems();
+	const bool bHasMorePages = ResultLimit > 0 && NumLoadedItems > 0 && NumLoadedItems % ResultLimit == 0;
+	if (DistanceRemaining > 0.0f || !bHasMorePages || bIsLoadingNextPage)
+	{
+		return;
+	}
+
+	// The next page is usually prefetched by the subsystem already, so it is served from its cache.
+	bIsLoadingNextPage = true;
+	const FString RequestedLeaderboardCode = LeaderboardCode;
+	const int32 RequestedPageIndex = NumLoadedItems / ResultLimit;
+	LeaderboardSubsystem->GetRankingsPage(
+		GetOwningPlayer(),
+		LeaderboardCode,
+		ResultLimit,
+		RequestedPageIndex,
+		FOnGetLeaderboardRankingComplete::CreateWeakLambda(this, [this, RequestedLeaderboardCode, RequestedPageIndex](bool bWasSuccessful, const TArray<ULeaderboardRank*> Rankings)
+		{
+			bIsLoadingNextPage = false;
+
+			// Ignore the page if the leaderboard was reopened while it was being loaded.
+			if (!bWasSuccessful
+				|| !RequestedLeaderboardCode.Equals(LeaderboardCode)
+				|| Lv_Leaderboard->GetNumItems() != RequestedPageIndex * ResultLimit)
+			{
+				return;
+			}
+
+			for (ULeaderboardRank* Ranking : Rankings)
+			{
+				Lv_Leaderboard->AddItem(Ranking);
+			}
+		}
+	));
+}
+
+#pragma endregion
@@ -56,4 +56,14 @@ protected:
 	UPROPERTY(BlueprintReadOnly, meta = (BindWidgetOptional, BlueprintProtected = true, AllowPrivateAccess = true))
 	ULeaderboardWidgetEntry* PlayerRankPanel;
 // @@@SNIPEND
+
+#pragma region "Ranking Pages"
+protected:
+	/**
+	 * @brief Load the next page of rankings once the list is scrolled to the end.
+	 */
+	void OnLeaderboardScrolled(float ItemOffset, float DistanceRemaining);
+
+	bool bIsLoadingNextPage = false;
+#pragma endregion
 };
@@ -93,17 +93,8 @@ void UPeriodicBoardSubsystem::GetPeriodicRankings(const APlayerController* PC, c
 
 	const int32 LocalUserNum = GetLocalUserNumFromPlayerController(PC);
 
-	FOnlineLeaderboardReadRef LeaderboardObj = MakeShared<FOnlineLeaderboardRead, ESPMode::ThreadSafe>();
-
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 5
-	LeaderboardObj->LeaderboardName = LeaderboardCode;
-#else
-	LeaderboardObj->LeaderboardName = FName(LeaderboardCode);
-#endif
-
-	// Get the periodic leaderboard within the range of 0 to ResultLimit.
-	OnLeaderboardReadCompleteDelegateHandle = LeaderboardInterface->AddOnLeaderboardReadCompleteDelegate_Handle(FOnLeaderboardReadCompleteDelegate::CreateUObject(this, &ThisClass::OnGetPeriodicRankingsComplete, LocalUserNum, LeaderboardObj, OnComplete));
-	LeaderboardInterface->ReadLeaderboardCycleAroundRank(0, ResultLimit, CycleId, LeaderboardObj);
+	// Get the first page of the periodic leaderboard, which is within the range of 0 to ResultLimit.
+	RequestPeriodicRankingsPage(LocalUserNum, LeaderboardCode, CycleId, ResultLimit, 0, false, OnComplete);
 }
 // @@@SNIPEND
 
@@ -139,15 +130,32 @@ void UPeriodicBoardSubsystem::GetPlayerPeriodicRanking(const APlayerController*
 	LeaderboardObj->LeaderboardName = FName(LeaderboardCode);
 #endif
 
-	// Get the player's periodic leaderboard ranking.
-	OnLeaderboardReadCompleteDelegateHandle = LeaderboardInterface->AddOnLeaderboardReadCompleteDelegate_Handle(FOnLeaderboardReadCompleteDelegate::CreateUObject(this, &ThisClass::OnGetPeriodicRankingsComplete, LocalUserNum, LeaderboardObj, OnComplete));
-	LeaderboardInterface->ReadLeaderboardsCycle(TArray<FUniqueNetIdRef>{ PlayerNetId->AsShared() }, LeaderboardObj, CycleId);
+	// Get the player's periodic leaderboard ranking, served from the page cache if it was read recently.
+	PageCache->GetRankings(
+		FLeaderboardPageCache::MakePlayerRankKey(LeaderboardCode, CycleId, PlayerNetId),
+		false,
+		[this, LocalUserNum, LeaderboardObj, PlayerNetId, CycleId](const FOnGetLeaderboardRankingComplete& OnReadComplete)
+		{
+			// Drop the completion delegate of a previous read that timed out, its late completion must not be handled.
+			LeaderboardInterface->ClearOnLeaderboardReadCompleteDelegate_Handle(OnLeaderboardReadCompleteDelegateHandle);
+			OnLeaderboardReadCompleteDelegateHandle = LeaderboardInterface->AddOnLeaderboardReadCompleteDelegate_Handle(FOnLeaderboardReadCompleteDelegate::CreateUObject(this, &ThisClass::OnGetPeriodicRankingsComplete, LocalUserNum, LeaderboardObj, OnReadComplete));
+			LeaderboardInterface->ReadLeaderboardsCycle(TArray<FUniqueNetIdRef>{ PlayerNetId->AsShared() }, LeaderboardObj, CycleId);
+		},
+		OnComplete);
 }
 // @@@SNIPEND
 
 // @@@SNIPSTART PeriodicBoardSubsystem.cpp-GetLeaderboardCycleIdByName
 void UPeriodicBoardSubsystem::GetLeaderboardCycleIdByName(const FString& InCycleName, const EAccelByteCycle& InCycleType, const FOnGetLeaderboardsCycleIdComplete& OnComplete)
 {
+	// Return the cycle id right away if it was already found before.
+	const FString CycleIdKey = MakeCycleIdKey(InCycleName, InCycleType);
+	if (const FString* CachedCycleId = CycleIdsByName.Find(CycleIdKey))
+	{
+		OnComplete.ExecuteIfBound(true, *CachedCycleId);
+		return;
+	}
+
 	AccelByte::FApiClientPtr ApiClient = UTutorialModuleOnlineUtility::GetApiClient(this);
 	if (!ApiClient) 
 	{
@@ -166,7 +174,7 @@ void UPeriodicBoardSubsystem::GetLeaderboardCycleIdByName(const FString& InCycle
 
 	StatisticApi->GetListStatCycleConfigs(
 		InCycleType,
-		THandler<FAccelByteModelsStatCycleConfigPagingResult>::CreateWeakLambda(this, [InCycleName, OnComplete](const FAccelByteModelsStatCycleConfigPagingResult& Result)
+		THandler<FAccelByteModelsStatCycleConfigPagingResult>::CreateWeakLambda(this, [this, InCycleName, CycleIdKey, OnComplete](const FAccelByteModelsStatCycleConfigPagingResult& Result)
 		{
 			FString FoundCycleId;
 			for (auto& Cycle : Result.Data)
@@ -181,6 +189,7 @@ void UPeriodicBoardSubsystem::GetLeaderboardCycleIdByName(const FString& InCycle
 			if (!FoundCycleId.IsEmpty())
 			{
 				UE_LOG_PERIODIC_LEADERBOARD(Log, TEXT("Cycle ID of cycle with name %s is %s."), *InCycleName, *FoundCycleId);
+				CycleIdsByName.Add(CycleIdKey, FoundCycleId);
 				OnComplete.ExecuteIfBound(true, FoundCycleId);
 			}
 			else
@@ -231,12 +240,20 @@ void UPeriodicBoardSubsystem::OnGetPeriodicRankingsComplete(
 		}
 	}
 
+	// Only query the user information of the members whose display names are not resolved yet.
+	const TArray<FUniqueNetIdRef> UnresolvedMembers = PageCache->GetUnresolvedUserIds(LeaderboardMembers);
+	if (UnresolvedMembers.IsEmpty())
+	{
+		OnQueryUserInfoComplete(FOnlineError::Success(), TArray<TSharedPtr<FUserOnlineAccountAccelByte>>(), LocalUserNum, LeaderboardObj, OnComplete);
+		return;
+	}
+
 	// Query periodic leaderboard members' user information.
 	if (UStartupSubsystem* StartupSubsystem = GetWorld()->GetGameInstance()->GetSubsystem<UStartupSubsystem>())
 	{
 		StartupSubsystem->QueryUserInfo(
 			LocalUserNum,
-			LeaderboardMembers,
+			UnresolvedMembers,
 			FOnQueryUsersInfoCompleteDelegate::CreateUObject(this, &ThisClass::OnQueryUserInfoComplete, LocalUserNum, LeaderboardObj, OnComplete));
 	}
 	else
@@ -258,6 +275,7 @@ void UPeriodicBoardSubsystem::OnQueryUserInfoComplete(
 	if (!ensure(UserInterface))
 	{
 		UE_LOG_PERIODIC_LEADERBOARD(Warning, TEXT("Cannot get periodic leaderboard. User Interface is not valid."));
+		OnComplete.ExecuteIfBound(false, TArray<ULeaderboardRank*>());
 		return;
 	}
 
@@ -299,12 +317,22 @@ void UPeriodicBoardSubsystem::OnQueryUserInfoComplete(
 			continue;
 		}
 
-		// Get the member's display name.
-		const TSharedPtr<FOnlineUser> LeaderboardMember = UserInterface->GetUserInfo(
-			LocalUserNum, Row.PlayerId->AsShared().Get());
-		const FString DisplayName = !LeaderboardMember->GetDisplayName().IsEmpty() ?
-			LeaderboardMember->GetDisplayName() : 
-			FText::Format(DEFAULT_LEADERBOARD_DISPLAY_NAME, FText::FromString(Row.NickName.Left(5))).ToString();
+		// Get the member's display name, reusing the one resolved by the previous queries if any.
+		FString DisplayName;
+		if (const FString* ResolvedDisplayName = PageCache->FindDisplayName(Row.PlayerId))
+		{
+			DisplayName = *ResolvedDisplayName;
+		}
+		else if (const TSharedPtr<FOnlineUser> LeaderboardMember = UserInterface->GetUserInfo(LocalUserNum, Row.PlayerId->AsShared().Get()))
+		{
+			DisplayName = LeaderboardMember->GetDisplayName();
+			PageCache->AddDisplayName(Row.PlayerId, DisplayName);
+		}
+
+		if (DisplayName.IsEmpty())
+		{
+			DisplayName = FText::Format(DEFAULT_LEADERBOARD_DISPLAY_NAME, FText::FromString(Row.NickName.Left(5))).ToString();
+		}
 
 		// Get the member's stat value.
 		float Score = 0;
@@ -330,3 +358,63 @@ void UPeriodicBoardSubsystem::OnQueryUserInfoComplete(
 // @@@SNIPEND
 
 #pragma endregion
+
+#pragma region "Leaderboard Page Cache"
+
+void UPeriodicBoardSubsystem::GetPeriodicRankingsPage(const APlayerController* PC, const FString& LeaderboardCode, const FString& CycleId, const int32 ResultLimit, const int32 PageIndex, const FOnGetLeaderboardRankingComplete& OnComplete)
+{
+	if (!ensure(LeaderboardInterface.IsValid()) || !ensure(UserInterface.IsValid()))
+	{
+		UE_LOG_PERIODIC_LEADERBOARD(Warning, TEXT("Cannot get periodic leaderboard rankings page. Leaderboard Interface or User Interface is not valid."));
+		OnComplete.ExecuteIfBound(false, TArray<ULeaderboardRank*>());
+		return;
+	}
+
+	if (!ensure(PC) || PageIndex < 0 || ResultLimit <= 0)
+	{
+		UE_LOG_PERIODIC_LEADERBOARD(Warning, TEXT("Cannot get periodic leaderboard rankings page. PlayerController is null or the page is invalid."));
+		OnComplete.ExecuteIfBound(false, TArray<ULeaderboardRank*>());
+		return;
+	}
+
+	RequestPeriodicRankingsPage(GetLocalUserNumFromPlayerController(PC), LeaderboardCode, CycleId, ResultLimit, PageIndex, false, OnComplete);
+}
+
+void UPeriodicBoardSubsystem::RequestPeriodicRankingsPage(const int32 LocalUserNum, const FString& LeaderboardCode, const FString& CycleId, const int32 ResultLimit, const int32 PageIndex, const bool bIsPrefetch, const FOnGetLeaderboardRankingComplete& OnComplete)
+{
+	PageCache->GetRankings(
+		FLeaderboardPageCache::MakePageKey(LeaderboardCode, CycleId, PageIndex, ResultLimit),
+		bIsPrefetch,
+		[this, LocalUserNum, LeaderboardCode, CycleId, ResultLimit, PageIndex](const FOnGetLeaderboardRankingComplete& OnReadComplete)
+		{
+			FOnlineLeaderboardReadRef LeaderboardObj = MakeShared<FOnlineLeaderboardRead, ESPMode::ThreadSafe>();
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 5
+			LeaderboardObj->LeaderboardName = LeaderboardCode;
+#else
+			LeaderboardObj->LeaderboardName = FName(LeaderboardCode);
+#endif
+
+			// Drop the completion delegate of a previous read that timed out, its late completion must not be handled.
+			LeaderboardInterface->ClearOnLeaderboardReadCompleteDelegate_Handle(OnLeaderboardReadCompleteDelegateHandle);
+			OnLeaderboardReadCompleteDelegateHandle = LeaderboardInterface->AddOnLeaderboardReadCompleteDelegate_Handle(FOnLeaderboardReadCompleteDelegate::CreateUObject(this, &ThisClass::OnGetPeriodicRankingsComplete, LocalUserNum, LeaderboardObj, OnReadComplete));
+			LeaderboardInterface->ReadLeaderboardCycleAroundRank(PageIndex * ResultLimit, ResultLimit, CycleId, LeaderboardObj);
+		},
+		FOnGetLeaderboardRankingComplete::CreateWeakLambda(this, [this, LocalUserNum, LeaderboardCode, CycleId, ResultLimit, PageIndex, bIsPrefetch, OnComplete](bool bWasSuccessful, const TArray<ULeaderboardRank*> Rankings)
+		{
+			OnComplete.ExecuteIfBound(bWasSuccessful, Rankings);
+
+			// A full page means there might be more rankings, prefetch the next page so it is ready when the player scrolls down.
+			if (bWasSuccessful && !bIsPrefetch && Rankings.Num() >= ResultLimit)
+			{
+				RequestPeriodicRankingsPage(LocalUserNum, LeaderboardCode, CycleId, ResultLimit, PageIndex + 1, true, FOnGetLeaderboardRankingComplete());
+			}
+		}));
+}
+
+FString UPeriodicBoardSubsystem::MakeCycleIdKey(const FString& InCycleName, const EAccelByteCycle& InCycleType)
+{
+	return FString::Printf(TEXT("%d;%s"), static_cast<int32>(InCycleType), *InCycleName);
+}
+
+#pragma endregion
@@ -10,6 +10,7 @@
 #include "OnlineUserInterfaceAccelByte.h"
 #include "OnlineLeaderboardInterfaceAccelByte.h"
 #include "Engagement/LeaderboardEssentials/LeaderboardEssentialsModels.h"
+#include "Engagement/LeaderboardEssentials/LeaderboardPageCache.h"
 #include "PeriodicLeaderboardLog.h"
 #include "PeriodicBoardSubsystem.generated.h"
 
@@ -79,4 +80,27 @@ protected:
 
 	FDelegateHandle OnLeaderboardReadCompleteDelegateHandle;
 // @@@SNIPEND
+
+#pragma region "Leaderboard Page Cache"
+public:
+	/**
+	 * @brief Get a page of rankings of a periodic leaderboard. Pages are cached and the next page is prefetched in the background.
+	 * @param PC PlayerController to determine who's credential is going to be used for the API call.
+	 * @param LeaderboardCode The leaderboard code (id) to be read.
+	 * @param CycleId The leaderboard periodic cycle to be read.
+	 * @param ResultLimit The maximum limit of leaderboard entries of a page.
+	 * @param PageIndex The zero-based index of the page to be read.
+	 */
+	void GetPeriodicRankingsPage(const APlayerController* PC, const FString& LeaderboardCode, const FString& CycleId, const int32 ResultLimit, const int32 PageIndex, const FOnGetLeaderboardRankingComplete& OnComplete = FOnGetLeaderboardRankingComplete());
+
+protected:
+	void RequestPeriodicRankingsPage(const int32 LocalUserNum, const FString& LeaderboardCode, const FString& CycleId, const int32 ResultLimit, const int32 PageIndex, const bool bIsPrefetch, const FOnGetLeaderboardRankingComplete& OnComplete);
+
+	static FString MakeCycleIdKey(const FString& InCycleName, const EAccelByteCycle& InCycleType);
+
+	TSharedRef<FLeaderboardPageCache> PageCache = MakeShared<FLeaderboardPageCache>();
+
+	// Cycle ids found by GetLeaderboardCycleIdByName(), keyed by cycle type and name. Cycle ids do not change, so they are kept for the session.
+	TMap<FString, FString> CycleIdsByName;
+#pragma endregion
 };
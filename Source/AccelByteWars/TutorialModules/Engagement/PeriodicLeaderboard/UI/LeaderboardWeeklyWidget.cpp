@@ -18,6 +18,9 @@ void ULeaderboardWeeklyWidget::NativeConstruct()
 
 	PeriodicLeaderboardSubsystem = GameInstance->GetSubsystem<UPeriodicBoardSubsystem>();
 	ensure(PeriodicLeaderboardSubsystem);
+
+	Lv_Leaderboard->OnListViewScrolled().RemoveAll(this);
+	Lv_Leaderboard->OnListViewScrolled().AddUObject(this, &ThisClass::OnLeaderboardScrolled);
 }
 
 // @@@SNIPSTART LeaderboardWeeklyWidget.cpp-NativeOnActivated
@@ -151,3 +154,47 @@ void ULeaderboardWeeklyWidget::DisplayPlayerWeeklyRank(const ULeaderboardRank* P
 	PlayerRankPanel->SetVisibility(ESlateVisibility::HitTestInvisible);
 }
 // @@@SNIPEND
+
+#pragma region "Ranking Pages"
+
+void ULeaderboardWeeklyWidget::OnLeaderboardScrolled(float ItemOffset, float DistanceRemaining)
+{
+	// If every loaded page is full, there might be more rankings to load.
+	const int32 NumLoadedItems = Lv_Leaderboard->GetNumItems();
+	const bool bHasMorePages = ResultLimit > 0 && NumLoadedItems > 0 && NumLoadedItems % ResultLimit == 0;
+	if (DistanceRemaining > 0.0f || !bHasMorePages || bIsLoadingNextPage)
+	{
+		return;
+	}
+
+	// The next page is usually prefetched by the subsystem already, so it is served from its cache.
+	bIsLoadingNextPage = true;
+	const FString RequestedLeaderboardCode = LeaderboardCode;
+	const int32 RequestedPageIndex = NumLoadedItems / ResultLimit;
+	PeriodicLeaderboardSubsystem->GetPeriodicRankingsPage(
+		GetOwningPlayer(),
+		LeaderboardCode,
+		CycleId,
+		ResultLimit,
+		RequestedPageIndex,
+		FOnGetLeaderboardRankingComplete::CreateWeakLambda(this, [this, RequestedLeaderboardCode, RequestedPageIndex](bool bWasSuccessful, const TArray<ULeaderboardRank*> Rankings)
+		{
+			bIsLoadingNextPage = false;
+
+			// Ignore the page if the leaderboard was reopened while it was being loaded.
+			if (!bWasSuccessful
+				|| !RequestedLeaderboardCode.Equals(LeaderboardCode)
+				|| Lv_Leaderboard->GetNumItems() != RequestedPageIndex * ResultLimit)
+			{
+				return;
+			}
+
+			for (ULeaderboardRank* Ranking : Rankings)
+			{
+				Lv_Leaderboard->AddItem(Ranking);
+			}
+		}
+	));
+}
+
+#pragma endregion
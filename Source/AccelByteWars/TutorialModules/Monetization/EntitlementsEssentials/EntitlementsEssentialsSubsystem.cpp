@@ -247,11 +247,13 @@ void UEntitlementsEssentialsSubsystem::QueryUserEntitlement(const FUniqueNetIdPt
 		return;
 	}
 
-	if (QueryProcess > 0)
+	// Abort if the user's entitlements are already being queried, the pending requests will be completed by that query.
+	const FString UserIdStr = UserId->ToString();
+	if (QueryingUserIds.Contains(UserIdStr))
 	{
 		return;
 	}
-	QueryProcess++;
+	QueryingUserIds.Add(UserIdStr);
 
 	// Trigger query entitlements.
 	EntitlementsInterface->QueryEntitlements(UserId.ToSharedRef().Get(), TEXT(""), FPagedQuery());
@@ -269,7 +271,8 @@ void UEntitlementsEssentialsSubsystem::OnQueryEntitlementComplete(
 	Error.bSucceeded = bWasSuccessful;
 	Error.ErrorRaw = ErrorMessage;
 
-	QueryResultUserId = UserId.AsShared();
+	const FUniqueNetIdRef ResultUserId = UserId.AsShared();
+	QueryResultUserId = ResultUserId;
 	QueryResultError = Error;
 
 	TArray<TSharedRef<FOnlineEntitlement>> Entitlements;
@@ -278,8 +281,12 @@ void UEntitlementsEssentialsSubsystem::OnQueryEntitlementComplete(
 	TArray<FOnlineStoreOfferAccelByteRef> Offers;
 	StoreInterface->GetOffers(Offers);
 
-	TArray<FString> OfferIds;
-	Algo::Transform(Offers, OfferIds, [](const FOnlineStoreOfferAccelByteRef Item) { return Item->OfferId; });
+	TSet<FString> OfferIds;
+	OfferIds.Reserve(Offers.Num());
+	for (const FOnlineStoreOfferAccelByteRef& Offer : Offers)
+	{
+		OfferIds.Add(Offer->OfferId);
+	}
 
 	TSet<FString> OfferIdsToQuery;
 	for (const TSharedRef<FOnlineEntitlement>& Entitlement : Entitlements)
@@ -293,11 +300,18 @@ void UEntitlementsEssentialsSubsystem::OnQueryEntitlementComplete(
 	// If not yet cached, query the offer information.
 	if (OfferIdsToQuery.IsEmpty()) 
 	{
-		OnQueryStoreOfferComplete(true, OfferIds, TEXT(""));
+		OnQueryStoreOfferComplete(true, OfferIds.Array(), TEXT(""));
 	}
 	else 
 	{
-		StoreInterface->QueryOffersById(UserId, OfferIdsToQuery.Array(), FOnQueryOnlineStoreOffersComplete::CreateUObject(this, &ThisClass::OnQueryStoreOfferComplete));
+		// Other users' queries may complete in the meantime, restore this query result before completing it.
+		StoreInterface->QueryOffersById(UserId, OfferIdsToQuery.Array(), FOnQueryOnlineStoreOffersComplete::CreateWeakLambda(this, [this, ResultUserId, Error]
+			(bool bQueryOffersSuccessful, const TArray<FUniqueOfferId>& QueriedOfferIds, const FString& QueryOffersError)
+			{
+				QueryResultUserId = ResultUserId;
+				QueryResultError = Error;
+				OnQueryStoreOfferComplete(bQueryOffersSuccessful, QueriedOfferIds, QueryOffersError);
+			}));
 	}
 }
 // @@@SNIPEND
@@ -308,12 +322,12 @@ void UEntitlementsEssentialsSubsystem::OnQueryStoreOfferComplete(
 	const TArray<FUniqueOfferId>& OfferIds, 
 	const FString& Error)
 {
-	QueryProcess--;
-
-	if (QueryProcess <= 0)
+	if (QueryResultUserId)
 	{
-		CompleteQuery();
+		QueryingUserIds.Remove(QueryResultUserId->ToString());
 	}
+
+	CompleteQuery();
 }
 // @@@SNIPEND
 
@@ -342,22 +356,40 @@ UStoreItemDataObject* UEntitlementsEssentialsSubsystem::GetItemEntitlement(
 // @@@SNIPSTART EntitlementsEssentialsSubsystem.cpp-CompleteQuery
 void UEntitlementsEssentialsSubsystem::CompleteQuery()
 {
+	if (!QueryResultUserId)
+	{
+		return;
+	}
+
+	// Convert the queried user's entitlements once, then share the result with every waiting request of that user.
+	TArray<UStoreItemDataObject*> EntitlementItems;
+	TMap<FUniqueOfferId, UStoreItemDataObject*> EntitlementItemsByOfferId;
+	if (QueryResultError.bSucceeded)
+	{
+		TArray<TSharedRef<FOnlineEntitlement>> Entitlements;
+		EntitlementsInterface->GetAllEntitlements(QueryResultUserId.ToSharedRef().Get(), FString(), Entitlements);
+
+		EntitlementItems = EntitlementsToDataObjects(Entitlements);
+		EntitlementItemsByOfferId.Reserve(EntitlementItems.Num());
+		for (UStoreItemDataObject* Item : EntitlementItems)
+		{
+			if (!EntitlementItemsByOfferId.Contains(Item->GetStoreItemId()))
+			{
+				EntitlementItemsByOfferId.Add(Item->GetStoreItemId(), Item);
+			}
+		}
+	}
+
 	// Trigger on complete delegate of GetOrQueryUserEntitlements function.
 	for (TMultiMap<const FUniqueNetIdRef, FOnGetOrQueryUserEntitlementsComplete>::TIterator It = UserEntitlementsParams.CreateIterator(); It; ++It)
 	{
 		const FUniqueNetIdRef& Key = It.Key();
-		if (!QueryResultUserId || Key.Get() != QueryResultUserId.ToSharedRef().Get())
+		if (Key.Get() != QueryResultUserId.ToSharedRef().Get())
 		{
 			continue;
 		}
 
-		TArray<TSharedRef<FOnlineEntitlement>> Entitlements;
-		if (QueryResultError.bSucceeded)
-		{
-			EntitlementsInterface->GetAllEntitlements(Key.Get(), FString(), Entitlements);
-		}
-
-		It.Value().Execute(QueryResultError, EntitlementsToDataObjects(Entitlements));
+		It.Value().Execute(QueryResultError, EntitlementItems);
 		It.RemoveCurrent();
 	}
 
@@ -366,12 +398,12 @@ void UEntitlementsEssentialsSubsystem::CompleteQuery()
 	{
 		const FUniqueOfferId& OfferId = It.Key();
 		const FUserItemEntitlementRequest& Request = It.Value();
-		if (!QueryResultUserId || Request.UserId.Get() != QueryResultUserId.ToSharedRef().Get())
+		if (Request.UserId.Get() != QueryResultUserId.ToSharedRef().Get())
 		{
 			continue;
 		}
 
-		Request.OnComplete.Execute(QueryResultError, GetItemEntitlement(Request.UserId, OfferId));
+		Request.OnComplete.Execute(QueryResultError, EntitlementItemsByOfferId.FindRef(OfferId));
 		It.RemoveCurrent();
 	}
 }
@@ -88,7 +88,7 @@ private:
 	TMultiMap<const FUniqueOfferId /*OfferId*/, FUserItemEntitlementRequest> UserItemEntitlementParams;
 	TMultiMap<const FString /*InGameItemId*/, FConsumeEntitlementRequest> ConsumeEntitlementParams;
 
-	uint8 QueryProcess = 0;
+	TSet<FString> QueryingUserIds;
 	FUniqueNetIdPtr QueryResultUserId;
 	FOnlineError QueryResultError;
 
@@ -8,7 +8,7 @@
 #include "Monetization/NativePlatformPurchase/NativePlatformPurchaseModels.h"
 #include "Misc/DateTime.h"
 
-UStoreItemDataObject* FInGameStoreEssentialsUtils::ConvertStoreData(const FOnlineStoreOffer& Offer)
+UStoreItemDataObject* FInGameStoreEssentialsUtils::ConvertStoreData(const FOnlineStoreOffer& Offer, UStoreItemDataObject* TargetItem)
 {
 	TMap<EItemSkuPlatform, FString> SkuMap;
 	if (const FString* SkuPtr = Offer.DynamicFields.Find(TEXT("Sku")))
@@ -90,7 +90,8 @@ UStoreItemDataObject* FInGameStoreEssentialsUtils::ConvertStoreData(const FOnlin
 		}
 	}
 
-	UStoreItemDataObject* Item = NewObject<UStoreItemDataObject>();
+	// Refresh the target item in place if any, so the objects already handed to the UI stay valid.
+	UStoreItemDataObject* Item = TargetItem ? TargetItem : NewObject<UStoreItemDataObject>();
 	const FString EmptyEntitlementId;
 	constexpr int32 Count = 1;
 	Item->Setup(
@@ -6,6 +6,9 @@
 #include "Core/UI/MainMenu/Store/StoreItemModel.h"
 #include "Interfaces/OnlineStoreInterfaceV2.h"
 
+#define STORE_CATALOG_SNAPSHOT_VERSION 1
+#define STORE_CATALOG_SNAPSHOT_FILE TEXT("InGameStoreCache/Catalog.json")
+
 // @@@SNIPSTART InGameStoreEssentialsModel.h-Delegates
 DECLARE_DELEGATE_OneParam(FOnGetOrQueryOffersByCategory, TArray<UStoreItemDataObject*> /*Offers*/)
 DECLARE_DELEGATE_OneParam(FOnGetOrQueryOfferById, UStoreItemDataObject* /*Offer*/)
@@ -17,6 +20,6 @@ class ACCELBYTEWARS_API FInGameStoreEssentialsUtils
 // @@@SNIPSTART InGameStoreEssentialsModel.h-public
 // @@@MULTISNIP ConvertStoreData {"selectedLines": ["1-2"]}
 public:	
-	static UStoreItemDataObject* ConvertStoreData(const FOnlineStoreOffer& Offer);
+	static UStoreItemDataObject* ConvertStoreData(const FOnlineStoreOffer& Offer, UStoreItemDataObject* TargetItem = nullptr);
 // @@@SNIPEND
 };
@@ -8,6 +8,9 @@
 #include "OnlineSubsystemUtils.h"
 #include "Core/AssetManager/InGameItems/InGameItemUtility.h"
 #include "Monetization/NativePlatformPurchase/NativePlatformPurchaseModels.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
 
 // @@@SNIPSTART InGameStoreEssentialsSubsystem.cpp-Initialize
 // @@@MULTISNIP StoreInterface {"selectedLines": ["1-2", "5-9"]}
@@ -30,11 +33,10 @@ void UInGameStoreEssentialsSubsystem::GetOrQueryOffersByCategory(
 	bool bForceRefresh)
 {
 	// Check overall cache.
-	TArray<FOnlineStoreOfferRef> Offers;
-	StoreInterface->GetOffers(Offers);
+	const bool bHasCatalog = EnsureCatalog(UserId);
 
 	// If empty or forced to refresh, call query.
-	if (Offers.IsEmpty() || bForceRefresh)
+	if (!bHasCatalog || bForceRefresh)
 	{
 		if (!UserId)
 		{
@@ -67,11 +69,10 @@ void UInGameStoreEssentialsSubsystem::GetOrQueryOfferById(
 	FOnGetOrQueryOfferById OnComplete)
 {
 	// Check overall cache.
-	TArray<FOnlineStoreOfferRef> Offers;
-	StoreInterface->GetOffers(Offers);
+	const bool bHasCatalog = EnsureCatalog(UserId);
 
 	// If empty, call query.
-	if (Offers.IsEmpty())
+	if (!bHasCatalog)
 	{
 		if (!UserId)
 		{
@@ -138,24 +139,23 @@ void UInGameStoreEssentialsSubsystem::GetOrQueryCategoriesByRootPath(
 // @@@SNIPSTART InGameStoreEssentialsSubsystem.cpp-GetOffersByCategory
 TArray<UStoreItemDataObject*> UInGameStoreEssentialsSubsystem::GetOffersByCategory(const FString Category) const
 {
-	TArray<FOnlineStoreOfferAccelByteRef> FilteredOffers;
-	TArray<UStoreItemDataObject*> StoreItems;
-
-	TArray<FOnlineStoreOfferAccelByteRef> Offers;
-	StoreInterface->GetOffers(Offers);
-	for (const FOnlineStoreOfferAccelByteRef& Offer : Offers)
+	// The catalog indexes the offers by their category paths.
+	if (const TArray<UStoreItemDataObject*>* CategoryOffers = CatalogCategoryOffers.Find(GetCatalogCategoryPath(Category)))
 	{
-		if (Offer->DynamicFields.Find(TEXT("Category"))->Find(Category) == 0 && 
-			Offer->IsPurchaseable() && 
-			Offer->Listable)
-		{
-			FilteredOffers.Add(Offer);
-		}
+		return *CategoryOffers;
 	}
 
-	for (const FOnlineStoreOfferAccelByteRef& Offer : FilteredOffers)
+	// The category is not a full path, fall back to match it as a prefix of the listed offers' category.
+	TArray<UStoreItemDataObject*> StoreItems;
+	if (const TArray<UStoreItemDataObject*>* ListedOffers = CatalogCategoryOffers.Find(FString()))
 	{
-		StoreItems.Add(FInGameStoreEssentialsUtils::ConvertStoreData(Offer.Get()));
+		for (UStoreItemDataObject* Item : *ListedOffers)
+		{
+			if (Item->GetCategory().ToString().Find(Category) == 0)
+			{
+				StoreItems.Add(Item);
+			}
+		}
 	}
 
 	return StoreItems;
@@ -165,12 +165,8 @@ TArray<UStoreItemDataObject*> UInGameStoreEssentialsSubsystem::GetOffersByCatego
 // @@@SNIPSTART InGameStoreEssentialsSubsystem.cpp-GetOfferById
 UStoreItemDataObject* UInGameStoreEssentialsSubsystem::GetOfferById(const FUniqueOfferId& OfferId) const
 {
-	UStoreItemDataObject* StoreItem = nullptr;
-	if (const TSharedPtr<FOnlineStoreOffer> Offer = StoreInterface->GetOffer(OfferId); Offer.IsValid())
-	{
-		StoreItem = FInGameStoreEssentialsUtils::ConvertStoreData(*Offer.Get());
-	}
-	return StoreItem;
+	UStoreItemDataObject* const* StoreItem = CatalogOffers.Find(OfferId);
+	return StoreItem ? *StoreItem : nullptr;
 }
 // @@@SNIPEND
 
@@ -199,6 +195,15 @@ void UInGameStoreEssentialsSubsystem::OnQueryOffersComplete(
 {
 	bIsQueryOfferRunning = false;
 
+	// Rebuild the catalog once for all waiting callers.
+	if (bWasSuccessful)
+	{
+		TArray<FOnlineStoreOfferAccelByteRef> Offers;
+		StoreInterface->GetOffers(Offers);
+		RebuildCatalog(Offers);
+		SaveCatalogSnapshot();
+	}
+
 	TArray<const FString*> OffersByCategoryDelegateToBeDeleted;
 	for (TTuple<const FString /*Category*/, FOnGetOrQueryOffersByCategory>& Delegate : OffersByCategoryDelegates)
 	{
@@ -297,3 +302,241 @@ void UInGameStoreEssentialsSubsystem::OnQueryCategoriesComplete(bool bWasSuccess
 	}
 }
 // @@@SNIPEND
+
+#pragma region "Store Catalog"
+bool UInGameStoreEssentialsSubsystem::EnsureCatalog(const FUniqueNetIdPtr UserId)
+{
+	if (bIsCatalogBuiltFromOffers)
+	{
+		return true;
+	}
+
+	// The offers might be queried by other modules, build the catalog from them.
+	TArray<FOnlineStoreOfferAccelByteRef> Offers;
+	StoreInterface->GetOffers(Offers);
+	if (!Offers.IsEmpty())
+	{
+		RebuildCatalog(Offers);
+		return true;
+	}
+
+	// Open the store from the last snapshot, while the offers are queried in the background.
+	if (CatalogOffers.IsEmpty())
+	{
+		LoadCatalogSnapshot();
+	}
+
+	if (!CatalogOffers.IsEmpty())
+	{
+		if (UserId)
+		{
+			QueryOffers(UserId);
+		}
+		return true;
+	}
+
+	return false;
+}
+
+void UInGameStoreEssentialsSubsystem::RebuildCatalog(const TArray<FOnlineStoreOfferAccelByteRef>& Offers)
+{
+	const TMap<FString, UStoreItemDataObject*> PreviousOffers = MoveTemp(CatalogOffers);
+	CatalogOffers.Reset();
+	CatalogCategoryOffers.Reset();
+	CatalogOffers.Reserve(Offers.Num());
+
+	for (const FOnlineStoreOfferAccelByteRef& Offer : Offers)
+	{
+		UStoreItemDataObject* const* PreviousItem = PreviousOffers.Find(Offer->OfferId);
+		UStoreItemDataObject* Item = FInGameStoreEssentialsUtils::ConvertStoreData(Offer.Get(), PreviousItem ? *PreviousItem : nullptr);
+		AddOfferToCatalog(Item, Offer->IsPurchaseable() && Offer->Listable);
+	}
+
+	bIsCatalogBuiltFromOffers = true;
+}
+
+void UInGameStoreEssentialsSubsystem::AddOfferToCatalog(UStoreItemDataObject* Item, const bool bIsListed)
+{
+	CatalogOffers.Add(Item->GetStoreItemId(), Item);
+	if (!bIsListed)
+	{
+		return;
+	}
+
+	// Add the offer to its category and every parent category, down to the empty root path.
+	FString CategoryPath = GetCatalogCategoryPath(Item->GetCategory().ToString());
+	while (true)
+	{
+		CatalogCategoryOffers.FindOrAdd(CategoryPath).Add(Item);
+
+		int32 SeparatorIndex = INDEX_NONE;
+		if (CategoryPath.IsEmpty() || !CategoryPath.FindLastChar(TEXT('/'), SeparatorIndex))
+		{
+			break;
+		}
+		CategoryPath.LeftInline(SeparatorIndex);
+	}
+}
+
+FString UInGameStoreEssentialsSubsystem::GetCatalogCategoryPath(const FString& Category)
+{
+	FString CategoryPath = Category;
+	CategoryPath.RemoveFromEnd(TEXT("/"));
+	return CategoryPath;
+}
+
+FString UInGameStoreEssentialsSubsystem::GetCatalogSnapshotFilePath()
+{
+	FString CachePath = TEXT("");
+#if (defined(PLATFORM_PS4) && PLATFORM_PS4) || (defined(PLATFORM_PS5) && PLATFORM_PS5)
+	CachePath = FPaths::ProjectPersistentDownloadDir();
+#else
+	CachePath = FPaths::ProjectSavedDir();
+#endif
+	return FPaths::Combine(CachePath, STORE_CATALOG_SNAPSHOT_FILE);
+}
+
+bool UInGameStoreEssentialsSubsystem::LoadCatalogSnapshot()
+{
+	FString JsonStr;
+	if (!FFileHelper::LoadFileToString(JsonStr, *GetCatalogSnapshotFilePath()))
+	{
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> JsonObject;
+	const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(JsonStr);
+	if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+	{
+		return false;
+	}
+
+	int32 Version = 0;
+	const TArray<TSharedPtr<FJsonValue>>* OfferValues = nullptr;
+	if (!JsonObject->TryGetNumberField(TEXT("Version"), Version) || Version != STORE_CATALOG_SNAPSHOT_VERSION ||
+		!JsonObject->TryGetArrayField(TEXT("Offers"), OfferValues))
+	{
+		return false;
+	}
+
+	for (const TSharedPtr<FJsonValue>& OfferValue : *OfferValues)
+	{
+		const TSharedPtr<FJsonObject>* OfferObject = nullptr;
+		if (!OfferValue.IsValid() || !OfferValue->TryGetObject(OfferObject))
+		{
+			continue;
+		}
+
+		FString OfferId;
+		if (!(*OfferObject)->TryGetStringField(TEXT("OfferId"), OfferId) || OfferId.IsEmpty())
+		{
+			continue;
+		}
+
+		TMap<EItemSkuPlatform, FString> SkuMap;
+		FString Sku;
+		if ((*OfferObject)->TryGetStringField(TEXT("Sku"), Sku) && !Sku.IsEmpty())
+		{
+			SkuMap.Add(EItemSkuPlatform::AccelByte, Sku);
+		}
+		if ((*OfferObject)->TryGetStringField(TEXT("NativeSku"), Sku) && !Sku.IsEmpty())
+		{
+			SkuMap.Add(EItemSkuPlatform::Native, Sku);
+		}
+
+		TArray<UStoreItemPriceDataObject*> Prices;
+		const TArray<TSharedPtr<FJsonValue>>* PriceValues = nullptr;
+		if ((*OfferObject)->TryGetArrayField(TEXT("Prices"), PriceValues))
+		{
+			for (const TSharedPtr<FJsonValue>& PriceValue : *PriceValues)
+			{
+				const TSharedPtr<FJsonObject>* PriceObject = nullptr;
+				if (!PriceValue.IsValid() || !PriceValue->TryGetObject(PriceObject))
+				{
+					continue;
+				}
+
+				UStoreItemPriceDataObject* PriceData = NewObject<UStoreItemPriceDataObject>();
+				PriceData->Setup(
+					static_cast<ECurrencyType>((*PriceObject)->GetIntegerField(TEXT("CurrencyType"))),
+					static_cast<int64>((*PriceObject)->GetNumberField(TEXT("RegularPrice"))),
+					static_cast<int64>((*PriceObject)->GetNumberField(TEXT("FinalPrice"))),
+					(*PriceObject)->GetStringField(TEXT("CurrencyCode")));
+				Prices.Add(PriceData);
+			}
+		}
+
+		UStoreItemDataObject* Item = NewObject<UStoreItemDataObject>();
+		const FString EmptyEntitlementId;
+		constexpr int32 Count = 1;
+		Item->Setup(
+			FText::FromString((*OfferObject)->GetStringField(TEXT("Title"))),
+			FText::FromString((*OfferObject)->GetStringField(TEXT("Category"))),
+			(*OfferObject)->GetStringField(TEXT("ItemType")),
+			OfferId,
+			EmptyEntitlementId,
+			(*OfferObject)->GetStringField(TEXT("IconUrl")),
+			SkuMap,
+			Prices,
+			Count,
+			(*OfferObject)->GetBoolField(TEXT("IsConsumable")));
+		AddOfferToCatalog(Item, (*OfferObject)->GetBoolField(TEXT("IsListed")));
+	}
+
+	return !CatalogOffers.IsEmpty();
+}
+
+bool UInGameStoreEssentialsSubsystem::SaveCatalogSnapshot() const
+{
+	TSet<const UStoreItemDataObject*> ListedOffers;
+	if (const TArray<UStoreItemDataObject*>* RootCategoryOffers = CatalogCategoryOffers.Find(FString()))
+	{
+		ListedOffers.Reserve(RootCategoryOffers->Num());
+		for (const UStoreItemDataObject* Item : *RootCategoryOffers)
+		{
+			ListedOffers.Add(Item);
+		}
+	}
+
+	TArray<TSharedPtr<FJsonValue>> OfferValues;
+	OfferValues.Reserve(CatalogOffers.Num());
+	for (const TPair<FString, UStoreItemDataObject*>& Offer : CatalogOffers)
+	{
+		const UStoreItemDataObject* Item = Offer.Value;
+		const TMap<EItemSkuPlatform, FString>& SkuMap = Item->GetSkuMap();
+
+		TSharedPtr<FJsonObject> OfferObject = MakeShareable(new FJsonObject);
+		OfferObject->SetStringField(TEXT("OfferId"), Item->GetStoreItemId());
+		OfferObject->SetStringField(TEXT("Title"), Item->GetTitle().ToString());
+		OfferObject->SetStringField(TEXT("Category"), Item->GetCategory().ToString());
+		OfferObject->SetStringField(TEXT("ItemType"), Item->GetItemType());
+		OfferObject->SetStringField(TEXT("IconUrl"), Item->GetIconUrl());
+		OfferObject->SetStringField(TEXT("Sku"), SkuMap.FindRef(EItemSkuPlatform::AccelByte));
+		OfferObject->SetStringField(TEXT("NativeSku"), SkuMap.FindRef(EItemSkuPlatform::Native));
+		OfferObject->SetBoolField(TEXT("IsConsumable"), Item->GetIsConsumable());
+		OfferObject->SetBoolField(TEXT("IsListed"), ListedOffers.Contains(Item));
+
+		TArray<TSharedPtr<FJsonValue>> PriceValues;
+		for (const UStoreItemPriceDataObject* Price : Item->GetPrices())
+		{
+			TSharedPtr<FJsonObject> PriceObject = MakeShareable(new FJsonObject);
+			PriceObject->SetNumberField(TEXT("CurrencyType"), static_cast<uint8>(Price->GetCurrencyType()));
+			PriceObject->SetNumberField(TEXT("RegularPrice"), Price->GetRegularPrice());
+			PriceObject->SetNumberField(TEXT("FinalPrice"), Price->GetFinalPrice());
+			PriceObject->SetStringField(TEXT("CurrencyCode"), Price->GetNativeCurrencyCode());
+			PriceValues.Add(MakeShareable(new FJsonValueObject(PriceObject)));
+		}
+		OfferObject->SetArrayField(TEXT("Prices"), PriceValues);
+
+		OfferValues.Add(MakeShareable(new FJsonValueObject(OfferObject)));
+	}
+
+	TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetNumberField(TEXT("Version"), STORE_CATALOG_SNAPSHOT_VERSION);
+	JsonObject->SetArrayField(TEXT("Offers"), OfferValues);
+
+	FString JsonStr;
+	const TSharedRef<TJsonWriter<TCHAR>> JsonWriter = TJsonWriterFactory<TCHAR>::Create(&JsonStr);
+	return FJsonSerializer::Serialize(JsonObject, JsonWriter) && FFileHelper::SaveStringToFile(JsonStr, *GetCatalogSnapshotFilePath());
+}
+#pragma endregion
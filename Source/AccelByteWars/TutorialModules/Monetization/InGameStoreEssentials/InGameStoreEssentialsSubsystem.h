@@ -67,4 +67,25 @@ private:
 	void QueryCategories(const FUniqueNetIdPtr UserId);
 	void OnQueryCategoriesComplete(bool bWasSuccessful, const FString& Error);
 // @@@SNIPEND
+
+#pragma region "Store Catalog"
+	bool EnsureCatalog(const FUniqueNetIdPtr UserId);
+	void RebuildCatalog(const TArray<FOnlineStoreOfferAccelByteRef>& Offers);
+	void AddOfferToCatalog(UStoreItemDataObject* Item, const bool bIsListed);
+	static FString GetCatalogCategoryPath(const FString& Category);
+
+	static FString GetCatalogSnapshotFilePath();
+	bool LoadCatalogSnapshot();
+	bool SaveCatalogSnapshot() const;
+
+	// Offer id to its data object. The objects are reused and refreshed in place when the offers are queried again.
+	UPROPERTY()
+	TMap<FString, UStoreItemDataObject*> CatalogOffers;
+
+	// Category path to the listed offers under it, including the offers of its sub-categories. The empty path holds every listed offer.
+	TMap<FString, TArray<UStoreItemDataObject*>> CatalogCategoryOffers;
+
+	// Whether the catalog is built from the store interface offers, or only loaded from the snapshot.
+	bool bIsCatalogBuiltFromOffers = false;
+#pragma endregion
 };
@@ -120,6 +120,11 @@ void URegionPreferencesWidget::OnRefreshRegionComplete(bool bWasSucceed)
 			Ws_Regions->SetWidgetState(EAccelByteWarsWidgetSwitcherState::Empty);
 		}
 	}
+	else if(RegionPreferencesSubsystem->GetRegionInfos().Num() > 0)
+	{
+		// Refresh failed, but the last known latencies are still usable.
+		SetupUI();
+	}
 	else
 	{
 		Ws_Regions->SetWidgetState(EAccelByteWarsWidgetSwitcherState::Error);
@@ -15,6 +15,9 @@
 #define REGION_OPT_OUT_TXT TEXT("OPT OUT")
 #define REGION_UNKNOWN TEXT("UNKNOWN")
 
+#define REGION_LATENCY_CACHE_VERSION 1
+#define REGION_LATENCY_CACHE_FILE TEXT("RegionPreferencesCache/RegionLatencies.json")
+
 UCLASS()
 class ACCELBYTEWARS_API URegionPreferenceInfo final : public UObject
 {
@@ -23,4 +26,7 @@ public:
 	FString RegionCode = TEXT("");
 	float Latency = 0.0f;
 	bool bEnabled = true;
+
+	// UTC time when the latency was last measured. Used to expire locally persisted latencies.
+	FDateTime LastUpdatedTime = FDateTime::MinValue();
 };
@@ -12,6 +12,9 @@
 #include "OnlineSubsystemAccelByteSessionSettings.h"
 #include "OnlineSubsystemUtils.h"
 #include "Api/AccelByteQos.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
 
 #define RETRY_LIMIT 3
 
@@ -27,6 +30,9 @@ void URegionPreferencesSubsystem::Initialize(FSubsystemCollectionBase& Collectio
 
 	GetIngameLatencyRefreshConfiguration();
 
+	// Serve the last known latencies right away, the background refresh will update them once lobby is connected.
+	LoadLatencyCache();
+
 	OnGetLatenciesSuccessDelegate = THandler<TArray<TPair<FString, float>>>::CreateUObject(this, &ThisClass::OnGetLatenciesSuccess);
 	if (FOnlineIdentityAccelBytePtr IdentityInterface = GetIdentityInterface())
 	{
@@ -46,6 +52,7 @@ void URegionPreferencesSubsystem::Deinitialize()
 	}
 
 	OnGetLatenciesSuccessDelegate.Unbind();
+	GetGameInstance()->GetTimerManager().ClearTimer(RegionLatencyRefreshTimerHandle);
 	if (FOnlineIdentityAccelBytePtr IdentityInterface = GetIdentityInterface())
 	{
 		IdentityInterface->ClearOnConnectLobbyCompleteDelegates(0, this);
@@ -75,19 +82,31 @@ void URegionPreferencesSubsystem::RefreshRegionLatency(bool bRetryOnFailed)
 		return;
 	}
 
+	// The pending request will broadcast its result to every listener, no need to send another one.
+	if (bIsRefreshingRegionLatency)
+	{
+		UE_LOG_REGION_PREFERENCES_ESSENTIALS(Log, TEXT("Region latencies refresh is already in progress."));
+		return;
+	}
+
+	bIsRefreshingRegionLatency = true;
 	QosApi->GetServerLatencies(OnGetLatenciesSuccessDelegate, FErrorHandler::CreateWeakLambda(this, [this, bRetryOnFailed](int32 ErrorCode, const FString& ErrorMessage)
 	{
 		UE_LOG_REGION_PREFERENCES_ESSENTIALS(Warning, TEXT("Error getting regions latency!! Error code: %d Error Message: %s"), ErrorCode, *ErrorMessage);
+		bIsRefreshingRegionLatency = false;
 		OnGetLatenciesError(ErrorCode, ErrorMessage);
 		if(bRetryOnFailed && NumRetry < RETRY_LIMIT)
 		{
-			UE_LOG_REGION_PREFERENCES_ESSENTIALS(Log, TEXT("Retry getting regions latency, retry num = %d"), NumRetry);
+			const float RetryDelay = GetRetryBackoffDelay();
+			UE_LOG_REGION_PREFERENCES_ESSENTIALS(Log, TEXT("Retry getting regions latency in %.2f seconds, retry num = %d"), RetryDelay, NumRetry);
 			NumRetry += 1;
-			RefreshRegionLatency(bRetryOnFailed);
+			ScheduleRegionLatencyRefresh(RetryDelay);
 		}
 		else
 		{
+			// Give up retrying for now and fall back to the regular background refresh.
 			NumRetry = 0;
+			ScheduleRegionLatencyRefresh(RegionLatencyRefreshInterval);
 		}
 	}));
 #endif
@@ -157,6 +176,7 @@ bool URegionPreferencesSubsystem::TryToggleRegion(const FString& RegionCode)
 		else
 		{
 			RegionInfo->bEnabled = !RegionInfo->bEnabled;
+			RegionAllowedLookup.Add(RegionInfo->RegionCode, RegionInfo->bEnabled);
 			return true;
 		}
 	}
@@ -187,6 +207,13 @@ URegionPreferenceInfo* URegionPreferencesSubsystem::FindRegionInfo(const FString
 	return nullptr;
 }
 
+bool URegionPreferencesSubsystem::IsRegionAllowed(const FString& RegionCode) const
+{
+	// Regions the player has never seen cannot be opted out, so they are allowed.
+	const bool* bAllowed = RegionAllowedLookup.Find(RegionCode);
+	return bAllowed == nullptr || *bAllowed;
+}
+
 FString URegionPreferencesSubsystem::GetCurrentGameSessionRegion()
 {
 	FString CurrentGameSessionRegion = TEXT("");
@@ -318,14 +345,7 @@ void URegionPreferencesSubsystem::FilterSessionSearch(TSharedRef<FOnlineSessionS
 				TSharedPtr<FAccelByteModelsV2GameSession> GameBackendSessionData = ABSessionInfo->GetBackendSessionDataAsGameSession();
 				if(GameBackendSessionData.IsValid())
 				{
-					if(RegionInfos.IsEmpty())
-					{
-						return false;
-					}
-					return RegionInfos.ContainsByPredicate([GameBackendSessionData](URegionPreferenceInfo* Info)
-					{
-						return Info->RegionCode.Equals(GameBackendSessionData->DSInformation.Server.Region) && !Info->bEnabled;
-					});
+					return !IsRegionAllowed(GameBackendSessionData->DSInformation.Server.Region);
 				}
 				else
 				{
@@ -413,6 +433,15 @@ void URegionPreferencesSubsystem::GetIngameLatencyRefreshConfiguration()
 		GConfig->GetBool(TEXT("AccelByteTutorialModules"), TEXT("bShowLatency"), bShowLatency, GEngineIni);
 		UE_LOG_REGION_PREFERENCES_ESSENTIALS(Log, TEXT("DefaultEngine.ini sets the latency refresh interval to %d."), LatencyRefreshInterval);
 	}
+
+	// Check region latency background refresh configuration
+	GConfig->GetFloat(TEXT("AccelByteTutorialModules"), TEXT("RegionLatencyRefreshInterval"), RegionLatencyRefreshInterval, GEngineIni);
+	GConfig->GetFloat(TEXT("AccelByteTutorialModules"), TEXT("RegionLatencyRetryBaseDelay"), RegionLatencyRetryBaseDelay, GEngineIni);
+	GConfig->GetFloat(TEXT("AccelByteTutorialModules"), TEXT("RegionLatencyRetryMaxDelay"), RegionLatencyRetryMaxDelay, GEngineIni);
+	GConfig->GetFloat(TEXT("AccelByteTutorialModules"), TEXT("RegionLatencySmoothingFactor"), RegionLatencySmoothingFactor, GEngineIni);
+	GConfig->GetInt(TEXT("AccelByteTutorialModules"), TEXT("RegionLatencyCacheMaxAge"), RegionLatencyCacheMaxAge, GEngineIni);
+	RegionLatencySmoothingFactor = FMath::Clamp(RegionLatencySmoothingFactor, KINDA_SMALL_NUMBER, 1.0f);
+	UE_LOG_REGION_PREFERENCES_ESSENTIALS(Log, TEXT("Region latency refresh interval is %.2f seconds, retry delay is %.2f to %.2f seconds."), RegionLatencyRefreshInterval, RegionLatencyRetryBaseDelay, RegionLatencyRetryMaxDelay);
 }
 
 void URegionPreferencesSubsystem::OnLobbyConnected(int32 LocalUserNum, bool bWasSuccessful, const FUniqueNetId& UserId, const FString& Error)
@@ -431,11 +460,25 @@ void URegionPreferencesSubsystem::OnLobbyConnected(int32 LocalUserNum, bool bWas
 		return;
 	}
 
+	// A refresh in flight will update the region latencies once it completes.
+	if (bIsRefreshingRegionLatency)
+	{
+		UE_LOG_REGION_PREFERENCES_ESSENTIALS(Log, TEXT("Region latency refresh is in progress. Skip initializing region latencies from the cache."));
+		return;
+	}
+
 	// Initialize region latencies from cache if any. Otherwise, query the region latencies.
+	// The cached samples may already be applied, so only add the missing regions instead of smoothing them again.
 	const TArray<TPair<FString, float>> Latencies = QosApi->GetCachedLatencies();
 	if (Latencies.Num() > 0)
 	{
-		OnGetLatenciesSuccess(Latencies);
+		UpdateRegionInfos(Latencies, false);
+		OnRefreshRegionComplete.Broadcast(true);
+
+		if (!GetGameInstance()->GetTimerManager().IsTimerActive(RegionLatencyRefreshTimerHandle))
+		{
+			ScheduleRegionLatencyRefresh(RegionLatencyRefreshInterval);
+		}
 	}
 	else
 	{
@@ -443,9 +486,164 @@ void URegionPreferencesSubsystem::OnLobbyConnected(int32 LocalUserNum, bool bWas
 	}
 }
 
+void URegionPreferencesSubsystem::ScheduleRegionLatencyRefresh(const float Delay)
+{
+	if (Delay <= 0.0f)
+	{
+		return;
+	}
+
+	GetGameInstance()->GetTimerManager().SetTimer(
+		RegionLatencyRefreshTimerHandle,
+		FTimerDelegate::CreateWeakLambda(this, [this]()
+		{
+			RefreshRegionLatency(true);
+		}),
+		Delay,
+		false);
+}
+
+float URegionPreferencesSubsystem::GetRetryBackoffDelay() const
+{
+	const float ExponentialDelay = FMath::Min(RegionLatencyRetryBaseDelay * FMath::Pow(2.0f, NumRetry), RegionLatencyRetryMaxDelay);
+
+	// Keep half of the delay and randomize the rest, so clients that failed together do not retry together.
+	return (ExponentialDelay * 0.5f) + FMath::FRandRange(0.0f, ExponentialDelay * 0.5f);
+}
+
+void URegionPreferencesSubsystem::RebuildRegionAllowedLookup()
+{
+	RegionAllowedLookup.Reset();
+	RegionAllowedLookup.Reserve(RegionInfos.Num());
+	for (const URegionPreferenceInfo* Info : RegionInfos)
+	{
+		RegionAllowedLookup.Add(Info->RegionCode, Info->bEnabled);
+	}
+}
+
+FString URegionPreferencesSubsystem::GetLatencyCacheFilePath()
+{
+	FString CachePath = TEXT("");
+#if (defined(PLATFORM_PS4) && PLATFORM_PS4) || (defined(PLATFORM_PS5) && PLATFORM_PS5)
+	CachePath = FPaths::ProjectPersistentDownloadDir();
+#else
+	CachePath = FPaths::ProjectSavedDir();
+#endif
+	return FPaths::Combine(CachePath, REGION_LATENCY_CACHE_FILE);
+}
+
+bool URegionPreferencesSubsystem::LoadLatencyCache()
+{
+	FString JsonStr;
+	if (!FFileHelper::LoadFileToString(JsonStr, *GetLatencyCacheFilePath()))
+	{
+		UE_LOG_REGION_PREFERENCES_ESSENTIALS(Log, TEXT("No region latency cache found at: %s"), *GetLatencyCacheFilePath());
+		return false;
+	}
+
+	TSharedPtr<FJsonObject> JsonObject;
+	const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(JsonStr);
+	if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid())
+	{
+		UE_LOG_REGION_PREFERENCES_ESSENTIALS(Warning, TEXT("Failed to load region latency cache from: %s"), *GetLatencyCacheFilePath());
+		return false;
+	}
+
+	int32 Version = 0;
+	if (!JsonObject->TryGetNumberField(TEXT("Version"), Version) || Version != REGION_LATENCY_CACHE_VERSION)
+	{
+		UE_LOG_REGION_PREFERENCES_ESSENTIALS(Log, TEXT("Region latency cache version mismatch, ignoring the cache."));
+		return false;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* RegionValues = nullptr;
+	if (!JsonObject->TryGetArrayField(TEXT("Regions"), RegionValues))
+	{
+		return false;
+	}
+
+	const FDateTime Now = FDateTime::UtcNow();
+	for (const TSharedPtr<FJsonValue>& RegionValue : *RegionValues)
+	{
+		const TSharedPtr<FJsonObject>* RegionObject = nullptr;
+		if (!RegionValue.IsValid() || !RegionValue->TryGetObject(RegionObject))
+		{
+			continue;
+		}
+
+		FString RegionCode;
+		double Latency = 0.0;
+		FString LastUpdatedTimeStr;
+		FDateTime LastUpdatedTime;
+		if (!(*RegionObject)->TryGetStringField(TEXT("RegionCode"), RegionCode) ||
+			!(*RegionObject)->TryGetNumberField(TEXT("Latency"), Latency) ||
+			!(*RegionObject)->TryGetStringField(TEXT("LastUpdatedTime"), LastUpdatedTimeStr) ||
+			!FDateTime::ParseIso8601(*LastUpdatedTimeStr, LastUpdatedTime))
+		{
+			continue;
+		}
+
+		// Skip latencies that are too old to be meaningful.
+		if ((Now - LastUpdatedTime).GetTotalSeconds() > RegionLatencyCacheMaxAge || FindRegionInfo(RegionCode) != nullptr)
+		{
+			continue;
+		}
+
+		URegionPreferenceInfo* RegionPreferenceInfo = NewObject<URegionPreferenceInfo>();
+		RegionPreferenceInfo->RegionCode = RegionCode;
+		RegionPreferenceInfo->Latency = static_cast<float>(Latency);
+		RegionPreferenceInfo->LastUpdatedTime = LastUpdatedTime;
+		RegionInfos.Add(RegionPreferenceInfo);
+	}
+
+	RebuildRegionAllowedLookup();
+
+	UE_LOG_REGION_PREFERENCES_ESSENTIALS(Log, TEXT("Loaded %d region latencies from: %s"), RegionInfos.Num(), *GetLatencyCacheFilePath());
+	return RegionInfos.Num() > 0;
+}
+
+bool URegionPreferencesSubsystem::SaveLatencyCache() const
+{
+	TArray<TSharedPtr<FJsonValue>> RegionValues;
+	for (const URegionPreferenceInfo* Info : RegionInfos)
+	{
+		TSharedPtr<FJsonObject> RegionObject = MakeShareable(new FJsonObject);
+		RegionObject->SetStringField(TEXT("RegionCode"), Info->RegionCode);
+		RegionObject->SetNumberField(TEXT("Latency"), Info->Latency);
+		RegionObject->SetStringField(TEXT("LastUpdatedTime"), Info->LastUpdatedTime.ToIso8601());
+		RegionValues.Add(MakeShareable(new FJsonValueObject(RegionObject)));
+	}
+
+	TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetNumberField(TEXT("Version"), REGION_LATENCY_CACHE_VERSION);
+	JsonObject->SetArrayField(TEXT("Regions"), RegionValues);
+
+	FString JsonStr;
+	const TSharedRef<TJsonWriter<TCHAR>> JsonWriter = TJsonWriterFactory<TCHAR>::Create(&JsonStr);
+	if (FJsonSerializer::Serialize(JsonObject, JsonWriter) && FFileHelper::SaveStringToFile(JsonStr, *GetLatencyCacheFilePath()))
+	{
+		UE_LOG_REGION_PREFERENCES_ESSENTIALS(Log, TEXT("Saved region latencies to: %s"), *GetLatencyCacheFilePath());
+		return true;
+	}
+
+	UE_LOG_REGION_PREFERENCES_ESSENTIALS(Warning, TEXT("Failed to save region latencies to: %s"), *GetLatencyCacheFilePath());
+	return false;
+}
+
 void URegionPreferencesSubsystem::OnGetLatenciesSuccess(const TArray<TPair<FString, float>>& InLatencies)
 {
-	UE_LOG_REGION_PREFERENCES_ESSENTIALS(Log, TEXT("Success getting regions latency"));;
+	UE_LOG_REGION_PREFERENCES_ESSENTIALS(Log, TEXT("Success getting regions latency"));
+	bIsRefreshingRegionLatency = false;
+
+	UpdateRegionInfos(InLatencies, true);
+
+	NumRetry = 0;
+	ScheduleRegionLatencyRefresh(RegionLatencyRefreshInterval);
+	OnRefreshRegionComplete.Broadcast(true);
+}
+
+void URegionPreferencesSubsystem::UpdateRegionInfos(const TArray<TPair<FString, float>>& InLatencies, const bool bIsNewSample)
+{
 	// remove regions that no longer exist
 	RegionInfos.RemoveAll([&InLatencies](const URegionPreferenceInfo* Info)
 	{
@@ -458,30 +656,39 @@ void URegionPreferencesSubsystem::OnGetLatenciesSuccess(const TArray<TPair<FStri
 	});
 
 	// update existing region info and add new one (if exist)
+	const FDateTime Now = FDateTime::UtcNow();
 	for(const TPair<FString, float>& Latency : InLatencies)
 	{
 		URegionPreferenceInfo* RegionInfo = FindRegionInfo(Latency.Key);
 		
 		if(RegionInfo != nullptr)
 		{
-			RegionInfo->Latency = Latency.Value;
+			if (!bIsNewSample)
+			{
+				continue;
+			}
+
+			// Smooth the latency with an exponentially weighted moving average so a single noisy probe does not reorder regions.
+			RegionInfo->Latency += RegionLatencySmoothingFactor * (Latency.Value - RegionInfo->Latency);
+			RegionInfo->LastUpdatedTime = Now;
 		}
 		else
 		{
 			URegionPreferenceInfo* RegionPreferenceInfo = NewObject<URegionPreferenceInfo>();
 			RegionPreferenceInfo->RegionCode = Latency.Key;
 			RegionPreferenceInfo->Latency = Latency.Value;
+			RegionPreferenceInfo->LastUpdatedTime = Now;
 			RegionInfos.Add(RegionPreferenceInfo);
 		}
 	}
-	
-	NumRetry = 0;
-	OnRefreshRegionComplete.Broadcast(true);
+
+	RebuildRegionAllowedLookup();
+	SaveLatencyCache();
 }
 
 void URegionPreferencesSubsystem::OnGetLatenciesError(int32 ErrorCode, const FString& ErrorMessage)
 {
-	RegionInfos.Empty();
+	// Keep the last known latencies, stale data is still better than none for session filtering and matchmaking.
 	OnRefreshRegionComplete.Broadcast(false);
 }
 #endif
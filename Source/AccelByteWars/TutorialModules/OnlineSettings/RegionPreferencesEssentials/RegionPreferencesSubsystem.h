@@ -35,6 +35,7 @@ public:
 	int32 GetEnabledRegionCount();
 	bool TryToggleRegion(const FString& RegionCode);
 	URegionPreferenceInfo* FindRegionInfo(const FString& RegionCode);
+	bool IsRegionAllowed(const FString& RegionCode) const;
 
 	FString GetCurrentGameSessionRegion();
 	bool ShouldShowLatencyInGame();
@@ -64,6 +65,17 @@ private:
 	void OnGetLatenciesSuccess(const TArray<TPair<FString, float>>& InLatencies);
 	void OnGetLatenciesError(int32 ErrorCode, const FString& ErrorMessage);
 	void OnLobbyConnected(int32 LocalUserNum, bool bWasSuccessful, const FUniqueNetId& UserId, const FString& Error);
+
+	/** @brief Only smooth the latencies of the existing regions if the samples are new, previously applied samples only add the missing regions. */
+	void UpdateRegionInfos(const TArray<TPair<FString, float>>& InLatencies, const bool bIsNewSample);
+
+	void ScheduleRegionLatencyRefresh(const float Delay);
+	float GetRetryBackoffDelay() const;
+	void RebuildRegionAllowedLookup();
+
+	static FString GetLatencyCacheFilePath();
+	bool LoadLatencyCache();
+	bool SaveLatencyCache() const;
 #endif
 	
 	UFUNCTION()
@@ -75,9 +87,22 @@ private:
 
 	UPROPERTY()
 	TArray<URegionPreferenceInfo*> RegionInfos;
+
+	// Region code to whether sessions hosted in that region may be shown. Rebuilt whenever the regions or their toggles change.
+	TMap<FString, bool> RegionAllowedLookup;
 	
 #if UE_EDITOR || !UE_SERVER
 	int32 NumRetry = 0;
+	bool bIsRefreshingRegionLatency = false;
+	FTimerHandle RegionLatencyRefreshTimerHandle;
+
+	// Background region latency refresh configuration, overridable from DefaultEngine.ini.
+	float RegionLatencyRefreshInterval = 300.0f;
+	float RegionLatencyRetryBaseDelay = 1.0f;
+	float RegionLatencyRetryMaxDelay = 60.0f;
+	float RegionLatencySmoothingFactor = 0.3f;
+	int32 RegionLatencyCacheMaxAge = 86400;
+
 	const FString CommandMyUserInfo = TEXT("ab.region.RefreshGameLatency");
 	bool bShowLatency = false;
 	int LatencyRefreshInterval = 5;
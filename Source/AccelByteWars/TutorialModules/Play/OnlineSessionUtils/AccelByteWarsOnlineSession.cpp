@@ -91,6 +91,8 @@ void UAccelByteWarsOnlineSession::RegisterOnlineDelegates()
 	// Match Session Essentials
 	SessionInt->OnFindSessionsCompleteDelegates.AddUObject(this, &ThisClass::OnFindSessionsComplete);
 	SessionSearch->SearchState = EOnlineAsyncTaskState::NotStarted;
+	GConfig->GetFloat(TEXT("AccelByteTutorialModules"), TEXT("SessionSearchCacheTTL"), SessionSearchCacheTTL, GEngineIni);
+	GConfig->GetFloat(TEXT("AccelByteTutorialModules"), TEXT("SessionSearchCacheMaxStaleAge"), SessionSearchCacheMaxStaleAge, GEngineIni);
 
 	// Party Essentials
 	ABSessionInt->OnCreateSessionCompleteDelegates.AddUObject(this, &ThisClass::OnCreatePartyComplete);
@@ -111,7 +113,7 @@ void UAccelByteWarsOnlineSession::RegisterOnlineDelegates()
 	ABSessionInt->OnSessionUpdateReceivedDelegates.AddUObject(this, &ThisClass::OnPartySessionUpdateReceived);
 
 	// Lobby Connection
-	GetABIdentityInt()->OnConnectLobbyCompleteDelegates->AddUObject(this, &ThisClass::OnConnectLobbyComplete);
+	GetABIdentityInt()->OnConnectLobbyCompleteDelegates->AddUObject(this, &ThisClass::OnLobbyConnectAttemptComplete);
 	FWorldDelegates::OnPostWorldInitialization.AddWeakLambda(this, [this](UWorld* World, const UWorld::InitializationValues IVS)
 	{
 		if (World)
@@ -190,6 +192,9 @@ void UAccelByteWarsOnlineSession::ClearOnlineDelegates()
 	{
 		GetWorld()->OnWorldBeginPlay.RemoveAll(this);
 	}
+	ResetLobbyReconnect();
+	ClearResyncChatWait();
+	InFlightLobbyResync.Reset();
 
 	DeinitializePartyGeneratedWidgets();
 }
@@ -1213,23 +1218,54 @@ void UAccelByteWarsOnlineSession::FindSessions(
 
 	if (SessionSearch->SearchState == EOnlineAsyncTaskState::InProgress)
 	{
-		UE_LOG_ONLINESESSION(Warning, TEXT("Currently searching"))
+		// Reply once the ongoing search (e.g. a background refresh) is complete.
+		UE_LOG_ONLINESESSION(Log, TEXT("Currently searching, waiting for the search to complete"))
+		bIsFindSessionsAwaited = true;
 		return;
 	}
 
+	// drop cache that was filtered with different region preferences
+	if (bHasCachedMatchSessions && CachedMatchSessionsRegions != GetSessionSearchRegions())
+	{
+		UE_LOG_ONLINESESSION(Log, TEXT("Region preferences changed, cache dropped"))
+		bHasCachedMatchSessions = false;
+	}
+
 	// check cache
-	if (!bForce && MaxQueryNum <= SessionSearch->SearchResults.Num())
+	const double CacheAge = FPlatformTime::Seconds() - CachedMatchSessionsTime;
+	if (!bForce
+		&& bHasCachedMatchSessions
+		&& MaxQueryNum <= CachedMatchSessionsMaxQueryNum
+		&& CacheAge < SessionSearchCacheMaxStaleAge)
 	{
-		UE_LOG_ONLINESESSION(Log, TEXT("Cache found"))
+		UE_LOG_ONLINESESSION(Log, TEXT("Cache found, age: %.1f seconds"), CacheAge)
 
 		// return cache
-		ExecuteNextTick(FTimerDelegate::CreateWeakLambda(this, [this]()
+		ExecuteNextTick(FTimerDelegate::CreateWeakLambda(this, [this, MatchSessions = CachedMatchSessions]()
 		{
-			OnFindSessionsComplete(true);
+			OnFindSessionsCompleteDelegates.Broadcast(MatchSessions, true);
 		}));
+
+		// Refresh stale cache in the background, the refreshed results are broadcast once they are ready.
+		if (CacheAge >= SessionSearchCacheTTL)
+		{
+			StartFindSessions(LocalUserNum, MaxQueryNum, true);
+		}
 		return;
 	}
 
+	StartFindSessions(LocalUserNum, MaxQueryNum, false);
+}
+
+void UAccelByteWarsOnlineSession::StartFindSessions(
+	const int32 LocalUserNum,
+	const int32 MaxQueryNum,
+	const bool bIsBackgroundRefresh)
+{
+	UE_LOG_ONLINESESSION(Log, TEXT("Background refresh: %s"), *FString(bIsBackgroundRefresh ? "TRUE": "FALSE"))
+
+	bIsFindSessionsAwaited = !bIsBackgroundRefresh;
+
 	SessionSearch->SearchState = EOnlineAsyncTaskState::NotStarted;
 	SessionSearch->MaxSearchResults = MaxQueryNum;
 	SessionSearch->SearchResults.Empty();
@@ -1256,6 +1292,7 @@ void UAccelByteWarsOnlineSession::OnFindSessionsComplete(bool bSucceeded)
 
 	if (bSucceeded)
 	{
+		// Filter the results once per search, the filtered results are cached for display.
 		// Remove owned session from result if exists
 		const FUniqueNetIdPtr LocalUserNetId = GetIdentityInt()->GetUniquePlayerId(LocalUserNumSearching);
 		SessionSearch->SearchResults.RemoveAll([this, LocalUserNetId](const FOnlineSessionSearchResult& Element)
@@ -1296,18 +1333,38 @@ void UAccelByteWarsOnlineSession::OnFindSessionsComplete(bool bSucceeded)
 		}
 #pragma endregion 
 
-		// Trigger immediately if the results are empty at this point.
-		if (SessionSearch->SearchResults.IsEmpty())
+		// Forget owners info that is too old to be served, even as a fallback.
+		const double Now = FPlatformTime::Seconds();
+		for (auto It = SessionOwnersInfoTime.CreateIterator(); It; ++It)
 		{
-			OnFindSessionsCompleteDelegates.Broadcast({}, true);
-			return;
+			if (Now - It.Value() >= SessionSearchCacheMaxStaleAge)
+			{
+				SessionOwnersInfo.Remove(It.Key());
+				It.RemoveCurrent();
+			}
 		}
 
-		// Get owner’s user info for queried user info.
-		TArray<FUniqueNetIdRef> UserIds;
+		// Only query the info of owners that were not queried before or were queried longer than the TTL ago.
+		TArray<FUniqueNetIdRef> UnresolvedOwnerIds;
 		for (const FOnlineSessionSearchResult& SearchResult : SessionSearch->SearchResults)
 		{
-			UserIds.AddUnique(SearchResult.Session.OwningUserId->AsShared());
+			if (!SearchResult.Session.OwningUserId.IsValid())
+			{
+				continue;
+			}
+
+			const double* OwnerInfoTime = SessionOwnersInfoTime.Find(GetSessionOwnerKey(SearchResult.Session.OwningUserId));
+			if (!OwnerInfoTime || Now - *OwnerInfoTime >= SessionSearchCacheTTL)
+			{
+				UnresolvedOwnerIds.AddUnique(SearchResult.Session.OwningUserId->AsShared());
+			}
+		}
+
+		// Complete right away if the results are empty or all owners are known at this point.
+		if (UnresolvedOwnerIds.IsEmpty())
+		{
+			CompleteFindSessions(true);
+			return;
 		}
 
 		// Trigger to query user info
@@ -1315,13 +1372,13 @@ void UAccelByteWarsOnlineSession::OnFindSessionsComplete(bool bSucceeded)
 		{
 			StartupSubsystem->QueryUserInfo(
 				LocalUserNumSearching,
-				UserIds,
+				UnresolvedOwnerIds,
 				FOnQueryUsersInfoCompleteDelegate::CreateUObject(this, &ThisClass::OnQueryUserInfoForFindSessionComplete));
 		}
 	}
 	else
 	{
-		OnFindSessionsCompleteDelegates.Broadcast({}, false);
+		CompleteFindSessions(false);
 	}
 }
 
@@ -1333,18 +1390,106 @@ void UAccelByteWarsOnlineSession::OnQueryUserInfoForFindSessionComplete(
 
 	if (Error.bSucceeded)
 	{
-		const TArray<FMatchSessionEssentialInfo> MatchSessionSearchResult = SimplifySessionSearchResult(
-			SessionSearch->SearchResults,
-			UsersInfo,
-			MatchSessionTemplateNameMap
-		);
+		const double Now = FPlatformTime::Seconds();
+		for (const TSharedPtr<FUserOnlineAccountAccelByte>& UserInfo : UsersInfo)
+		{
+			if (UserInfo.IsValid())
+			{
+				const FString OwnerKey = GetSessionOwnerKey(UserInfo->GetUserId());
+				SessionOwnersInfo.Add(OwnerKey, UserInfo);
+				SessionOwnersInfoTime.Add(OwnerKey, Now);
+			}
+		}
+	}
+
+	CompleteFindSessions(Error.bSucceeded);
+}
 
-		OnFindSessionsCompleteDelegates.Broadcast(MatchSessionSearchResult, true);
+void UAccelByteWarsOnlineSession::CompleteFindSessions(const bool bSucceeded)
+{
+	const bool bWasAwaited = bIsFindSessionsAwaited;
+	bIsFindSessionsAwaited = false;
+
+	// Keep serving the previous results if a background refresh failed.
+	if (!bSucceeded)
+	{
+		if (bWasAwaited)
+		{
+			OnFindSessionsCompleteDelegates.Broadcast({}, false);
+		}
+		else
+		{
+			UE_LOG_ONLINESESSION(Warning, TEXT("Failed to refresh cached session search results in the background"))
+		}
+		return;
 	}
-	else
+
+	TArray<TSharedPtr<FUserOnlineAccountAccelByte>> OwnersInfo;
+	for (const FOnlineSessionSearchResult& SearchResult : SessionSearch->SearchResults)
+	{
+		if (!SearchResult.Session.OwningUserId.IsValid())
+		{
+			continue;
+		}
+
+		if (const TSharedPtr<FUserOnlineAccountAccelByte>* OwnerInfo = SessionOwnersInfo.Find(GetSessionOwnerKey(SearchResult.Session.OwningUserId)))
+		{
+			OwnersInfo.AddUnique(*OwnerInfo);
+		}
+	}
+
+	CachedMatchSessions = SimplifySessionSearchResult(
+		SessionSearch->SearchResults,
+		OwnersInfo,
+		MatchSessionTemplateNameMap
+	);
+	CachedMatchSessionsTime = FPlatformTime::Seconds();
+	CachedMatchSessionsMaxQueryNum = SessionSearch->MaxSearchResults;
+	CachedMatchSessionsRegions = GetSessionSearchRegions();
+	bHasCachedMatchSessions = true;
+
+	OnFindSessionsCompleteDelegates.Broadcast(CachedMatchSessions, true);
+}
+
+FString UAccelByteWarsOnlineSession::GetSessionOwnerKey(const FUniqueNetIdPtr& UserId)
+{
+	if (!UserId.IsValid())
+	{
+		return FString();
+	}
+
+	const FUniqueNetIdAccelByteUserPtr AbUserId = FUniqueNetIdAccelByteUser::TryCast(*UserId);
+	return AbUserId.IsValid() ? AbUserId->GetAccelByteId() : UserId->ToString();
+}
+
+TArray<FString> UAccelByteWarsOnlineSession::GetSessionSearchRegions()
+{
+	TArray<FString> EnabledRegions;
+
+	const UTutorialModuleDataAsset* ModuleDataAsset = UTutorialModuleUtility::GetTutorialModuleDataAsset(
+		FPrimaryAssetId{ "TutorialModule:REGIONPREFERENCES" },
+		this,
+		true);
+	const UAccelByteWarsGameInstance* GameInstance = Cast<UAccelByteWarsGameInstance>(GetGameInstance());
+	if (!ModuleDataAsset || !GameInstance)
+	{
+		return EnabledRegions;
+	}
+
+	if (ModuleDataAsset->IsStarterModeActive())
+	{
+		if (URegionPreferencesSubsystem_Starter* RegionPreferencesSubsystem = GameInstance->GetSubsystem<URegionPreferencesSubsystem_Starter>())
+		{
+			EnabledRegions = RegionPreferencesSubsystem->GetEnabledRegion();
+		}
+	}
+	else if (URegionPreferencesSubsystem* RegionPreferencesSubsystem = GameInstance->GetSubsystem<URegionPreferencesSubsystem>())
 	{
-		OnFindSessionsCompleteDelegates.Broadcast({}, false);
+		EnabledRegions = RegionPreferencesSubsystem->GetEnabledRegion();
 	}
+
+	EnabledRegions.Sort();
+	return EnabledRegions;
 }
 #pragma endregion
 
@@ -1414,7 +1559,7 @@ void UAccelByteWarsOnlineSession::InitializePartyGeneratedWidgets()
 				OnInviteToPartyButtonClicked(GetLocalUserNumFromPlayerController(ParentWidget->GetOwningPlayer()), FriendUserId);
 			}
 		});
-		InviteToPartyButtonMetadata->OnWidgetGenerated.AddUObject(this, &ThisClass::UpdatePartyGeneratedWidgets);
+		InviteToPartyButtonMetadata->OnWidgetGenerated.AddUObject(this, &ThisClass::UpdatePartyGeneratedWidgets, false);
 	}
 
 	// Assign action button to kick player from the party.
@@ -1435,7 +1580,7 @@ void UAccelByteWarsOnlineSession::InitializePartyGeneratedWidgets()
 				OnKickPlayerFromPartyButtonClicked(GetLocalUserNumFromPlayerController(ParentWidget->GetOwningPlayer()), FriendUserId);
 			}
 		});
-		KickPlayerFromPartyButtonMetadata->OnWidgetGenerated.AddUObject(this, &ThisClass::UpdatePartyGeneratedWidgets);
+		KickPlayerFromPartyButtonMetadata->OnWidgetGenerated.AddUObject(this, &ThisClass::UpdatePartyGeneratedWidgets, false);
 	}
 
 	// Assign action button to promote party leader.
@@ -1456,7 +1601,7 @@ void UAccelByteWarsOnlineSession::InitializePartyGeneratedWidgets()
 				OnPromotePartyLeaderButtonClicked(GetLocalUserNumFromPlayerController(ParentWidget->GetOwningPlayer()), FriendUserId);
 			}
 		});
-		PromotePartyLeaderButtonMetadata->OnWidgetGenerated.AddUObject(this, &ThisClass::UpdatePartyGeneratedWidgets);
+		PromotePartyLeaderButtonMetadata->OnWidgetGenerated.AddUObject(this, &ThisClass::UpdatePartyGeneratedWidgets, false);
 	}
 
 	// On party update events, update the generated widget.
@@ -1464,14 +1609,14 @@ void UAccelByteWarsOnlineSession::InitializePartyGeneratedWidgets()
 	{
 		GetOnCreatePartyCompleteDelegates()->AddWeakLambda(this, [this](FName SessionName, bool bWasSuccessful)
 		{
-			UpdatePartyGeneratedWidgets();
+			UpdatePartyGeneratedWidgets(true);
 		});
 	}
 	if (GetOnLeavePartyCompleteDelegates())
 	{
 		GetOnLeavePartyCompleteDelegates()->AddWeakLambda(this, [this](FName SessionName, bool bWasSuccessful)
 		{
-			UpdatePartyGeneratedWidgets();
+			UpdatePartyGeneratedWidgets(true);
 		});
 	}
 
@@ -1480,7 +1625,7 @@ void UAccelByteWarsOnlineSession::InitializePartyGeneratedWidgets()
 	{
 		GetOnPartyMembersChangeDelegates()->AddWeakLambda(this, [this](FName SessionName, const FUniqueNetId& Member, bool bJoined)
 			{
-				UpdatePartyGeneratedWidgets();
+				UpdatePartyGeneratedWidgets(true);
 			});
 	}
 #else
@@ -1488,14 +1633,14 @@ void UAccelByteWarsOnlineSession::InitializePartyGeneratedWidgets()
 	{
 		GetOnPartyMemberJoinedDelegates()->AddWeakLambda(this, [this](FName SessionName, const FUniqueNetId& Member)
 		{
-			UpdatePartyGeneratedWidgets();
+			UpdatePartyGeneratedWidgets(true);
 		});
 	}
 	if (GetOnPartyMemberLeftDelegates())
 	{
 		GetOnPartyMemberLeftDelegates()->AddWeakLambda(this, [this](FName SessionName, const FUniqueNetId& Member, EOnSessionParticipantLeftReason Reason)
 		{
-			UpdatePartyGeneratedWidgets();
+			UpdatePartyGeneratedWidgets(true);
 		});
 	}
 #endif
@@ -1504,12 +1649,12 @@ void UAccelByteWarsOnlineSession::InitializePartyGeneratedWidgets()
 	{
 		GetOnPartySessionUpdateReceivedDelegates()->AddWeakLambda(this, [this](FName SessionName)
 		{
-			UpdatePartyGeneratedWidgets();
+			UpdatePartyGeneratedWidgets(true);
 		});
 	}
 }
 
-void UAccelByteWarsOnlineSession::UpdatePartyGeneratedWidgets()
+void UAccelByteWarsOnlineSession::UpdatePartyGeneratedWidgets(const bool bSkipIfUnchanged)
 {
 	// Take local user ID reference from active widget.
 	FUniqueNetIdPtr LocalUserABId = nullptr;
@@ -1521,6 +1666,17 @@ void UAccelByteWarsOnlineSession::UpdatePartyGeneratedWidgets()
 	// Take current displayed friend ID.
 	const FUniqueNetIdPtr FriendUserId = GetCurrentDisplayedFriendId();
 
+	// Skip if neither the party nor the displayed players changed since the last update.
+	const FString WidgetsState = FString::Printf(TEXT("%u;%s;%s"),
+		GetPartyStateSnapshot().Version,
+		LocalUserABId ? *GetPartyStateUserId(*LocalUserABId) : TEXT(""),
+		FriendUserId ? *GetPartyStateUserId(*FriendUserId) : TEXT(""));
+	if (bSkipIfUnchanged && WidgetsState.Equals(LastPartyGeneratedWidgetsState))
+	{
+		return;
+	}
+	LastPartyGeneratedWidgetsState = WidgetsState;
+
 	// Check party information.
 	const bool bIsInParty = IsInParty(LocalUserABId);
 	const bool bIsLeader = IsPartyLeader(LocalUserABId);
@@ -1650,6 +1806,9 @@ void UAccelByteWarsOnlineSession::OnInviteToPartyButtonClicked(const int32 Local
 		}
 	}
 
+	// The button must be refreshed by the next party event, even if the party stays the same.
+	LastPartyGeneratedWidgetsState.Reset();
+
 	SendPartyInvite(LocalUserNum, Invitee);
 }
 
@@ -1665,6 +1824,9 @@ void UAccelByteWarsOnlineSession::OnKickPlayerFromPartyButtonClicked(const int32
 		}
 	}
 
+	// The button must be refreshed by the next party event, even if the party stays the same.
+	LastPartyGeneratedWidgetsState.Reset();
+
 	KickPlayerFromParty(LocalUserNum, KickedPlayer);
 }
 
@@ -1680,6 +1842,9 @@ void UAccelByteWarsOnlineSession::OnPromotePartyLeaderButtonClicked(const int32
 		}
 	}
 
+	// The button must be refreshed by the next party event, even if the party stays the same.
+	LastPartyGeneratedWidgetsState.Reset();
+
 	PromotePartyLeader(LocalUserNum, NewLeader);
 }
 
@@ -1718,32 +1883,20 @@ FUniqueNetIdPtr UAccelByteWarsOnlineSession::GetPartyLeader()
 }
 
 bool UAccelByteWarsOnlineSession::IsInParty(const FUniqueNetIdPtr UserId)
+{
+	// Look up the cached party state instead of the party session's registered players.
+	return UserId && GetPartyStateSnapshot().MemberIds.Contains(GetPartyStateUserId(*UserId));
+}
+
+bool UAccelByteWarsOnlineSession::IsPartyLeader(const FUniqueNetIdPtr UserId)
 {
 	if (!UserId)
 	{
 		return false;
 	}
 
-	const TArray<FUniqueNetIdRef> Members = GetPartyMembers();
-	for (const auto& Member : Members)
-	{
-		if (!Member.Get().IsValid())
-		{
-			continue;
-		}
-
-		if (Member.Get() == UserId.ToSharedRef().Get())
-		{
-			return true;
-		}
-	}
-
-	return false;
-}
-
-bool UAccelByteWarsOnlineSession::IsPartyLeader(const FUniqueNetIdPtr UserId)
-{
-	return GetPartyLeader() && UserId && UserId.ToSharedRef().Get() == GetPartyLeader().ToSharedRef().Get();
+	const FString& LeaderId = GetPartyStateSnapshot().LeaderId;
+	return !LeaderId.IsEmpty() && LeaderId.Equals(GetPartyStateUserId(*UserId));
 }
 
 void UAccelByteWarsOnlineSession::CreateParty(const int32 LocalUserNum)
@@ -2087,6 +2240,8 @@ void UAccelByteWarsOnlineSession::PromotePartyLeader(const int32 LocalUserNum, c
 
 void UAccelByteWarsOnlineSession::OnCreatePartyComplete(FName SessionName, bool bSucceeded)
 {
+	InvalidatePartyStateSnapshot();
+
 	if (SessionName != GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession))
 	{
 		return;
@@ -2112,6 +2267,8 @@ void UAccelByteWarsOnlineSession::OnCreatePartyComplete(FName SessionName, bool
 
 void UAccelByteWarsOnlineSession::OnLeavePartyComplete(FName SessionName, bool bSucceeded)
 {
+	InvalidatePartyStateSnapshot();
+
 	if (SessionName != GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession))
 	{
 		return;
@@ -2162,6 +2319,8 @@ void UAccelByteWarsOnlineSession::OnSendPartyInviteComplete(const FUniqueNetId&
 
 void UAccelByteWarsOnlineSession::OnJoinPartyComplete(FName SessionName, EOnJoinSessionCompleteResult::Type Result)
 {
+	InvalidatePartyStateSnapshot();
+
 	if (SessionName != GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession))
 	{
 		return;
@@ -2353,6 +2512,8 @@ void UAccelByteWarsOnlineSession::DisplayJoinPartyConfirmation(const int32 Local
 
 void UAccelByteWarsOnlineSession::OnKickPlayerFromPartyComplete(bool bWasSuccessful, const FUniqueNetId& KickedPlayer)
 {
+	InvalidatePartyStateSnapshot();
+
 	const FUniqueNetIdAccelByteUserRef KickedPlayerABId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(KickedPlayer.AsShared());
 	if (bWasSuccessful)
 	{
@@ -2371,6 +2532,8 @@ void UAccelByteWarsOnlineSession::OnKickPlayerFromPartyComplete(bool bWasSuccess
 
 void UAccelByteWarsOnlineSession::OnKickedFromParty(FName SessionName)
 {
+	InvalidatePartyStateSnapshot();
+
 	// Abort if not a party session.
 	if (SessionName != GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession))
 	{
@@ -2390,6 +2553,8 @@ void UAccelByteWarsOnlineSession::OnKickedFromParty(FName SessionName)
 
 void UAccelByteWarsOnlineSession::OnPromotePartyLeaderComplete(const FUniqueNetId& NewLeader, const FOnlineError& Result)
 {
+	InvalidatePartyStateSnapshot();
+
 	const FUniqueNetIdAccelByteUserRef NewLeaderABId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(NewLeader.AsShared());
 	if (Result.bSucceeded)
 	{
@@ -2451,6 +2616,8 @@ void UAccelByteWarsOnlineSession::DisplayCurrentPartyLeader()
 #if UNREAL_ENGINE_VERSION_OLDER_THAN_5_2
 void UAccelByteWarsOnlineSession::OnPartyMembersChange(FName SessionName, const FUniqueNetId& Member, bool bJoined)
 {
+	InvalidatePartyStateSnapshot();
+
 	// Abort if not a party session.
 	if (SessionName != GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession))
 	{
@@ -2531,6 +2698,8 @@ void UAccelByteWarsOnlineSession::OnPartyMembersChange(FName SessionName, const
 #else
 void UAccelByteWarsOnlineSession::OnPartyMemberJoined(FName SessionName, const FUniqueNetId& Member)
 {
+	InvalidatePartyStateSnapshot();
+
 	// Abort if not a party session.
 	if (SessionName != GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession))
 	{
@@ -2608,6 +2777,8 @@ void UAccelByteWarsOnlineSession::OnPartyMemberJoined(FName SessionName, const F
 
 void UAccelByteWarsOnlineSession::OnPartyMemberLeft(FName SessionName, const FUniqueNetId& Member, EOnSessionParticipantLeftReason Reason)
 {
+	InvalidatePartyStateSnapshot();
+
 	// Abort if not a party session.
 	if (SessionName != GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession))
 	{
@@ -2687,6 +2858,8 @@ void UAccelByteWarsOnlineSession::OnPartyMemberLeft(FName SessionName, const FUn
 
 void UAccelByteWarsOnlineSession::OnPartySessionUpdateReceived(FName SessionName)
 {
+	InvalidatePartyStateSnapshot();
+
 	// Abort if not a party session.
 	if (SessionName != GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession))
 	{
@@ -2795,9 +2968,9 @@ void UAccelByteWarsOnlineSession::CheckLobbyConnection()
 }
 
 // @@@SNIPSTART AccelByteWarsOnlineSession.cpp-OnConnectLobbyComplete
-// @@@MULTISNIP AccelByteOnLobbyReconnectingDelegates {"selectedLines": ["1-2", "11-15", "149", "153", "156"]}
-// @@@MULTISNIP AccelByteOnLobbyConnectionClosedDelegates {"selectedLines": ["1-2", "11-15", "151", "155-156"]}
-// @@@MULTISNIP FailedConnect {"selectedLines": ["1-2", "11-27", "35-85", "156"]}
+// @@@MULTISNIP AccelByteOnLobbyReconnectingDelegates {"selectedLines": ["1-2", "11-15", "99", "103", "106"]}
+// @@@MULTISNIP AccelByteOnLobbyConnectionClosedDelegates {"selectedLines": ["1-2", "11-15", "101", "105-106"]}
+// @@@MULTISNIP FailedConnect {"selectedLines": ["1-2", "11-27", "35-85", "106"]}
 void UAccelByteWarsOnlineSession::OnConnectLobbyComplete(int32 LocalUserNum, bool bSucceeded, const FUniqueNetId& UserId, const FString& Error)
 {
 	GetPromptSubystem()->HideLoading();
@@ -2884,67 +3057,17 @@ void UAccelByteWarsOnlineSession::OnConnectLobbyComplete(int32 LocalUserNum, boo
 		return;
 	}
 
-	if (GameInstance->bIsReconnecting)
+	const bool bIsReconnected = GameInstance->bIsReconnecting;
+	if (bIsReconnected)
 	{
 		GameInstance->bIsReconnecting = false;
-		
-		// Trigger chat reconnect 
-		if (StaticCastSharedPtr<FUserOnlineAccountAccelByte>(GetABIdentityInt()->GetUserAccount(UserId))) 
-		{
-			ChatConnect(LocalUserNum, UserId.AsShared());
-		}
 
 		// Show success to reconnect to AGS pop-up message.
 		GetPromptSubystem()->ShowMessagePopUp(MESSAGE_PROMPT_TEXT, LOBBY_SUCCESS_RECONNECT_MESSAGE);
 	}
 
-	// Restore and leave old party session.
-	ABSessionInt->RestoreActiveSessions(
-		UserId,
-		FOnRestoreActiveSessionsComplete::CreateWeakLambda(this, [this](const FUniqueNetId& LocalUserId, const FOnlineError& Result)
-		{
-			// Abort if failed to restore party sessions.
-			if (!Result.bSucceeded)
-			{
-				UE_LOG_ONLINESESSION(Warning, TEXT("Failed to restore party session. Error: %s"), *Result.ErrorMessage.ToString());
-				return;
-			}
-
-			// Abort if the session interface is invalid.
-			if (!GetABSessionInt())
-			{
-				UE_LOG_ONLINESESSION(Warning, TEXT("Failed to restore party session. Session Interface is not valid."));
-				return;
-			}
-
-			const TArray<FOnlineRestoredSessionAccelByte> RestoredParties = GetABSessionInt()->GetAllRestoredPartySessions();
-
-			// If no restored party session, do nothing.
-			if (RestoredParties.IsEmpty())
-			{
-				UE_LOG_ONLINESESSION(Log, TEXT("No restored party session found. Do nothing."));
-				return;
-			}
-
-			// Leave the first restored active party session.
-			UE_LOG_ONLINESESSION(Log, TEXT("Restored party session found. Leave the restored party session."));
-			GetABSessionInt()->LeaveRestoredSession(
-				LocalUserId, 
-				RestoredParties[0],
-				FOnLeaveSessionComplete::CreateWeakLambda(this, [](bool bWasSuccessful, FString SessionId)
-				{
-					if (bWasSuccessful)
-					{
-						UE_LOG_ONLINESESSION(Log, TEXT("Success to leave restored party session."));
-					}
-					else
-					{
-						UE_LOG_ONLINESESSION(Warning, TEXT("Failed to leave restored party session."));
-					}
-				}
-			));
-		})
-	);
+	// Restore and leave old party session, then reconnect chat if needed.
+	ResyncLobbyStates(LocalUserNum, UserId.AsShared(), bIsReconnected);
 
 	ABIdentityInt->AccelByteOnLobbyReconnectingDelegates->RemoveAll(this);
 	ABIdentityInt->AccelByteOnLobbyReconnectedDelegates->RemoveAll(this);
@@ -2990,10 +3113,14 @@ void UAccelByteWarsOnlineSession::OnLobbyReconnected()
 		return;
 	}
 
-	// Trigger chat connect
+	// Trigger party and chat resync
 	int32 LocalUserNum = LocalPlayer->GetControllerId();
 	FUniqueNetIdPtr UserId = LocalPlayer->GetPreferredUniqueNetId().GetUniqueNetId();
-	ChatConnect(LocalUserNum, UserId);
+	ResetLobbyReconnect();
+	if (UserId)
+	{
+		ResyncLobbyStates(LocalUserNum, UserId.ToSharedRef(), true);
+	}
 	
 	GameInstance->bIsReconnecting = false;
 	GetPromptSubystem()->HideLoading();
@@ -3022,10 +3149,224 @@ void UAccelByteWarsOnlineSession::OnLobbyConnectionClosed(int32 LocalUserNum, co
 
 	if (StatusCode == static_cast<int32>(AccelByte::EWebsocketErrorTypes::DisconnectFromExternalReconnect))
 	{
-		// Do some manual handle to reconnect lobby
+		// Do some manual handle to reconnect lobby, with backoff in case the lobby keeps dropping the connection.
 		GameInstance->bIsReconnecting = true;
 		GetPromptSubystem()->ShowLoading(LOBBY_RECONNECTING_MESSAGE);
-		LobbyConnect(LocalUserNum);
+		ScheduleLobbyReconnect(LocalUserNum);
 	}
 }
 // @@@SNIPEND
+
+#pragma region "Lobby Connection Manager"
+void UAccelByteWarsOnlineSession::OnLobbyConnectAttemptComplete(int32 LocalUserNum, bool bSucceeded, const FUniqueNetId& UserId, const FString& Error)
+{
+	// While reconnecting with backoff, only report the failure once the attempts run out.
+	if (!bSucceeded && LobbyReconnectAttempts > 0 && LobbyReconnectAttempts < LOBBY_RECONNECT_MAX_ATTEMPTS)
+	{
+		UE_LOG_ONLINESESSION(Warning, TEXT("Failed to reconnect to lobby on attempt %d. Error: %s"), LobbyReconnectAttempts, *Error);
+		ScheduleLobbyReconnect(LocalUserNum);
+		return;
+	}
+
+	if (LobbyReconnectAttempts > 0)
+	{
+		UE_LOG_ONLINESESSION(Log, TEXT("Lobby reconnect %s after %d attempt(s)."), bSucceeded ? TEXT("succeeded") : TEXT("failed"), LobbyReconnectAttempts);
+	}
+
+	ResetLobbyReconnect();
+	OnConnectLobbyComplete(LocalUserNum, bSucceeded, UserId, Error);
+}
+
+void UAccelByteWarsOnlineSession::ScheduleLobbyReconnect(const int32 LocalUserNum)
+{
+	LobbyReconnectAttempts++;
+
+	// Exponential backoff with jitter, so the players dropped at the same time don't reconnect in lockstep.
+	const float Delay = FMath::Min(
+		LOBBY_RECONNECT_BASE_DELAY * FMath::Pow(2.0f, static_cast<float>(LobbyReconnectAttempts - 1)),
+		LOBBY_RECONNECT_MAX_DELAY);
+	const float JitteredDelay = Delay + FMath::FRandRange(0.0f, Delay * 0.5f);
+
+	UE_LOG_ONLINESESSION(Log, TEXT("Reconnecting to lobby in %.2f seconds. Attempt %d of %d."), JitteredDelay, LobbyReconnectAttempts, LOBBY_RECONNECT_MAX_ATTEMPTS);
+	GetGameInstance()->GetTimerManager().SetTimer(
+		LobbyReconnectTimerHandle,
+		FTimerDelegate::CreateUObject(this, &ThisClass::LobbyConnect, LocalUserNum),
+		JitteredDelay,
+		false);
+}
+
+void UAccelByteWarsOnlineSession::ResetLobbyReconnect()
+{
+	LobbyReconnectAttempts = 0;
+	if (const UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearTimer(LobbyReconnectTimerHandle);
+	}
+}
+
+void UAccelByteWarsOnlineSession::ResyncLobbyStates(const int32 LocalUserNum, const FUniqueNetIdRef& UserId, const bool bIsReconnected)
+{
+	// Both the lobby connect and the lobby reconnected events may arrive for the same reconnect, resync only once.
+	if (InFlightLobbyResync.IsSet())
+	{
+		UE_LOG_ONLINESESSION(Log, TEXT("Lobby states are already being resynced."));
+		InFlightLobbyResync->bIsReconnected |= bIsReconnected;
+		return;
+	}
+
+	FLobbyResync Resync;
+	Resync.LocalUserNum = LocalUserNum;
+	Resync.UserId = UserId;
+	Resync.bIsReconnected = bIsReconnected;
+	InFlightLobbyResync = Resync;
+
+	UE_LOG_ONLINESESSION(Log, TEXT("Resyncing lobby states."));
+	ResyncPartyState();
+}
+
+void UAccelByteWarsOnlineSession::ResyncPartyState()
+{
+	InvalidatePartyStateSnapshot();
+
+	if (!GetABSessionInt())
+	{
+		UE_LOG_ONLINESESSION(Warning, TEXT("Failed to restore party session. Session Interface is not valid."));
+		ResyncChatState();
+		return;
+	}
+
+	// Restore and leave old party session.
+	GetABSessionInt()->RestoreActiveSessions(
+		InFlightLobbyResync->UserId.ToSharedRef().Get(),
+		FOnRestoreActiveSessionsComplete::CreateWeakLambda(this, [this](const FUniqueNetId& LocalUserId, const FOnlineError& Result)
+		{
+			// Move on to the chat resync if failed to restore party sessions.
+			if (!Result.bSucceeded)
+			{
+				UE_LOG_ONLINESESSION(Warning, TEXT("Failed to restore party session. Error: %s"), *Result.ErrorMessage.ToString());
+				ResyncChatState();
+				return;
+			}
+
+			// Abort if the session interface is invalid.
+			if (!GetABSessionInt())
+			{
+				UE_LOG_ONLINESESSION(Warning, TEXT("Failed to restore party session. Session Interface is not valid."));
+				ResyncChatState();
+				return;
+			}
+
+			const TArray<FOnlineRestoredSessionAccelByte> RestoredParties = GetABSessionInt()->GetAllRestoredPartySessions();
+
+			// If no restored party session, do nothing.
+			if (RestoredParties.IsEmpty())
+			{
+				UE_LOG_ONLINESESSION(Log, TEXT("No restored party session found. Do nothing."));
+				ResyncChatState();
+				return;
+			}
+
+			// Leave the first restored active party session.
+			UE_LOG_ONLINESESSION(Log, TEXT("Restored party session found. Leave the restored party session."));
+			GetABSessionInt()->LeaveRestoredSession(
+				LocalUserId, 
+				RestoredParties[0],
+				FOnLeaveSessionComplete::CreateWeakLambda(this, [this](bool bWasSuccessful, FString SessionId)
+				{
+					if (bWasSuccessful)
+					{
+						UE_LOG_ONLINESESSION(Log, TEXT("Success to leave restored party session."));
+					}
+					else
+					{
+						UE_LOG_ONLINESESSION(Warning, TEXT("Failed to leave restored party session."));
+					}
+
+					ResyncChatState();
+				}
+			));
+		})
+	);
+}
+
+void UAccelByteWarsOnlineSession::ResyncChatState()
+{
+	if (!InFlightLobbyResync.IsSet())
+	{
+		return;
+	}
+
+	// The chat connection is only lost together with the lobby connection, so there is nothing to resync on the first connect.
+	if (!InFlightLobbyResync->bIsReconnected)
+	{
+		CompleteLobbyResync();
+		return;
+	}
+
+	const TSharedPtr<FUserOnlineAccountAccelByte> UserAccount = StaticCastSharedPtr<FUserOnlineAccountAccelByte>(
+		GetABIdentityInt()->GetUserAccount(InFlightLobbyResync->UserId.ToSharedRef().Get()));
+	const IOnlineSubsystem* Subsystem = Online::GetSubsystem(GetWorld());
+	const FOnlineChatAccelBytePtr ChatInt = Subsystem ? StaticCastSharedPtr<FOnlineChatAccelByte>(Subsystem->GetChatInterface()) : nullptr;
+	if (!UserAccount || UserAccount->IsConnectedToChat() || !ChatInt)
+	{
+		CompleteLobbyResync();
+		return;
+	}
+
+	// Wait for the chat to connect, but don't hold the resync forever if it doesn't.
+	OnResyncChatConnectedDelegateHandle = ChatInt->OnConnectChatCompleteDelegates->AddWeakLambda(this, [this](int32 LocalUserNum, bool bWasSuccessful, const FUniqueNetId& UserId, const FString& ErrorMessage)
+	{
+		if (!bWasSuccessful)
+		{
+			UE_LOG_ONLINESESSION(Warning, TEXT("Failed to reconnect chat while resyncing lobby states. Error: %s"), *ErrorMessage);
+		}
+
+		CompleteLobbyResync();
+	});
+	GetGameInstance()->GetTimerManager().SetTimer(
+		ResyncChatTimeoutTimerHandle,
+		FTimerDelegate::CreateWeakLambda(this, [this]()
+		{
+			UE_LOG_ONLINESESSION(Warning, TEXT("Timed out waiting for chat to reconnect while resyncing lobby states."));
+			CompleteLobbyResync();
+		}),
+		LOBBY_RESYNC_CHAT_TIMEOUT,
+		false);
+
+	ChatConnect(InFlightLobbyResync->LocalUserNum, InFlightLobbyResync->UserId);
+}
+
+void UAccelByteWarsOnlineSession::CompleteLobbyResync()
+{
+	if (!InFlightLobbyResync.IsSet())
+	{
+		return;
+	}
+
+	ClearResyncChatWait();
+
+	const FLobbyResync Resync = InFlightLobbyResync.GetValue();
+	InFlightLobbyResync.Reset();
+
+	UE_LOG_ONLINESESSION(Log, TEXT("Lobby states resynced."));
+	OnLobbyResyncedDelegates.Broadcast(Resync.LocalUserNum, Resync.bIsReconnected);
+}
+
+void UAccelByteWarsOnlineSession::ClearResyncChatWait()
+{
+	if (OnResyncChatConnectedDelegateHandle.IsValid())
+	{
+		const IOnlineSubsystem* Subsystem = Online::GetSubsystem(GetWorld());
+		if (const FOnlineChatAccelBytePtr ChatInt = Subsystem ? StaticCastSharedPtr<FOnlineChatAccelByte>(Subsystem->GetChatInterface()) : nullptr)
+		{
+			ChatInt->OnConnectChatCompleteDelegates->Remove(OnResyncChatConnectedDelegateHandle);
+		}
+		OnResyncChatConnectedDelegateHandle.Reset();
+	}
+
+	if (const UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearTimer(ResyncChatTimeoutTimerHandle);
+	}
+}
+#pragma endregion
@@ -304,6 +304,34 @@ private:
 	void OnQueryUserInfoForFindSessionComplete(
 		const FOnlineError& Error,
 		const TArray<TSharedPtr<FUserOnlineAccountAccelByte>>& UsersInfo);
+
+	void StartFindSessions(const int32 LocalUserNum, const int32 MaxQueryNum, const bool bIsBackgroundRefresh);
+	void CompleteFindSessions(const bool bSucceeded);
+	static FString GetSessionOwnerKey(const FUniqueNetIdPtr& UserId);
+	TArray<FString> GetSessionSearchRegions();
+
+	/**
+	 * Session search results younger than the TTL are served from the cache. Older results are still served,
+	 * but refreshed in the background, until they reach the max stale age. Overridable from DefaultEngine.ini.
+	 */
+	float SessionSearchCacheTTL = 15.0f;
+	float SessionSearchCacheMaxStaleAge = 120.0f;
+
+	// Session search results after the owned session and region filtering, ready to be displayed.
+	TArray<FMatchSessionEssentialInfo> CachedMatchSessions;
+	double CachedMatchSessionsTime = 0.0;
+	int32 CachedMatchSessionsMaxQueryNum = 0;
+	bool bHasCachedMatchSessions = false;
+
+	// Enabled regions the cached results were filtered with, the cache is dropped once they change.
+	TArray<FString> CachedMatchSessionsRegions;
+
+	// Whether the result of the ongoing search is waited for, background refreshes only broadcast when they succeed.
+	bool bIsFindSessionsAwaited = false;
+
+	// Session owners info by AccelByte user id, so only new or expired owners are queried.
+	TMap<FString, TSharedPtr<FUserOnlineAccountAccelByte>> SessionOwnersInfo;
+	TMap<FString, double> SessionOwnersInfoTime;
 #pragma endregion 
 
 #pragma region "Party Essentials"
@@ -394,7 +422,7 @@ protected:
 	void OnLeavePartyToTriggerEvent(FName SessionName, bool bSucceeded, const TDelegate<void(bool bWasSuccessful)> OnComplete);
 
 	void InitializePartyGeneratedWidgets();
-	void UpdatePartyGeneratedWidgets();
+	void UpdatePartyGeneratedWidgets(const bool bSkipIfUnchanged = false);
 	void DeinitializePartyGeneratedWidgets();
 	FUniqueNetIdPtr GetCurrentDisplayedFriendId();
 
@@ -437,6 +465,9 @@ private:
 	FTutorialModuleGeneratedWidget* KickPlayerFromPartyButtonMetadata;
 	FTutorialModuleGeneratedWidget* PromotePartyLeaderButtonMetadata;
 
+	// Party state and displayed players the generated widgets were last updated with.
+	FString LastPartyGeneratedWidgetsState;
+
 	const FString PartySessionTemplate = FString("unreal-party");
 	FUniqueNetIdPtr LastPartyLeader;
 	/* Helper variable to cache party member status. */
@@ -467,6 +498,12 @@ private:
 #pragma endregion
 
 #pragma region "Lobby Essentials"
+public:
+	virtual FOnLobbyResynced* GetOnLobbyResyncedDelegates() override
+	{
+		return &OnLobbyResyncedDelegates;
+	}
+
 protected:
 	void LobbyConnect(int32 LocalUserNum);
 	void ChatConnect(int32 LocalUserNum, const FUniqueNetIdPtr UserId);
@@ -475,5 +512,37 @@ protected:
 	void OnLobbyReconnecting(int32 LocalUserNum, const FUniqueNetId& UserId, int32 StatusCode, const FString& Reason, bool bWasClean);
 	void OnLobbyReconnected();
 	void OnLobbyConnectionClosed(int32 LocalUserNum, const FUniqueNetId& UserId, int32 StatusCode, const FString& Reason, bool bWasClean);
+
+private:
+	struct FLobbyResync
+	{
+		int32 LocalUserNum = 0;
+		FUniqueNetIdPtr UserId;
+		bool bIsReconnected = false;
+	};
+
+	void OnLobbyConnectAttemptComplete(int32 LocalUserNum, bool bSucceeded, const FUniqueNetId& UserId, const FString& Error);
+	void ScheduleLobbyReconnect(const int32 LocalUserNum);
+	void ResetLobbyReconnect();
+
+	/**
+	 * @brief Resync the states that depend on the lobby connection in order: the party session first, then the chat connection.
+	 * OnLobbyResyncedDelegates is broadcast once everything is resynced, so the dependent subsystems don't query on their own.
+	 */
+	void ResyncLobbyStates(const int32 LocalUserNum, const FUniqueNetIdRef& UserId, const bool bIsReconnected);
+	void ResyncPartyState();
+	void ResyncChatState();
+	void CompleteLobbyResync();
+	void ClearResyncChatWait();
+
+	FOnLobbyResynced OnLobbyResyncedDelegates;
+
+	// Reconnect attempts made since the lobby connection was lost, zero if not reconnecting with backoff.
+	int32 LobbyReconnectAttempts = 0;
+	FTimerHandle LobbyReconnectTimerHandle;
+
+	TOptional<FLobbyResync> InFlightLobbyResync;
+	FDelegateHandle OnResyncChatConnectedDelegateHandle;
+	FTimerHandle ResyncChatTimeoutTimerHandle;
 #pragma endregion
 };
@@ -336,3 +336,58 @@ TArray<FMatchSessionEssentialInfo> UAccelByteWarsOnlineSessionBase::SimplifySess
 	return SessionEssentialInfos;
 }
 #pragma endregion
+
+#pragma region "Party Essentials"
+const FPartyStateSnapshot& UAccelByteWarsOnlineSessionBase::GetPartyStateSnapshot()
+{
+	// The party session could be left or replaced without a party event, e.g. on logout.
+	FString PartySessionId;
+	if (GetABSessionInt())
+	{
+		if (const FNamedOnlineSession* PartySession = GetABSessionInt()->GetNamedSession(GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession)))
+		{
+			PartySessionId = PartySession->GetSessionIdStr();
+		}
+	}
+
+	if (!bIsPartyStateSnapshotDirty && PartySessionId.Equals(PartyStateSnapshot.PartySessionId))
+	{
+		return PartyStateSnapshot;
+	}
+	bIsPartyStateSnapshotDirty = false;
+
+	TSet<FString> MemberIds;
+	for (const FUniqueNetIdRef& Member : GetPartyMembers())
+	{
+		if (Member->IsValid())
+		{
+			MemberIds.Add(GetPartyStateUserId(Member.Get()));
+		}
+	}
+
+	const FUniqueNetIdPtr Leader = GetPartyLeader();
+	const FString LeaderId = (Leader && Leader->IsValid()) ? GetPartyStateUserId(*Leader) : FString();
+
+	// Only increase the version if the party actually changed, so the listeners can skip redundant refreshes.
+	const bool bHasChanged =
+		!PartySessionId.Equals(PartyStateSnapshot.PartySessionId) ||
+		!LeaderId.Equals(PartyStateSnapshot.LeaderId) ||
+		MemberIds.Num() != PartyStateSnapshot.MemberIds.Num() ||
+		!MemberIds.Includes(PartyStateSnapshot.MemberIds);
+	if (bHasChanged)
+	{
+		PartyStateSnapshot.PartySessionId = PartySessionId;
+		PartyStateSnapshot.MemberIds = MoveTemp(MemberIds);
+		PartyStateSnapshot.LeaderId = LeaderId;
+		PartyStateSnapshot.Version++;
+	}
+
+	return PartyStateSnapshot;
+}
+
+FString UAccelByteWarsOnlineSessionBase::GetPartyStateUserId(const FUniqueNetId& UserId)
+{
+	const FUniqueNetIdAccelByteUserPtr UserABId = FUniqueNetIdAccelByteUser::TryCast(UserId);
+	return UserABId.IsValid() ? UserABId->GetAccelByteId() : UserId.ToString();
+}
+#pragma endregion
@@ -190,6 +190,9 @@ public:
 	virtual bool IsInParty(const FUniqueNetIdPtr UserId) { return false; };
 	virtual bool IsPartyLeader(const FUniqueNetIdPtr UserId) { return false; };
 
+	const FPartyStateSnapshot& GetPartyStateSnapshot();
+	static FString GetPartyStateUserId(const FUniqueNetId& UserId);
+
 	virtual void CreateParty(const int32 LocalUserNum) {}
 	virtual void LeaveParty(const int32 LocalUserNum) {}
 
@@ -250,6 +253,12 @@ protected:
 #endif
 
 	virtual void OnPartySessionUpdateReceived(FName SessionName) {}
+
+	void InvalidatePartyStateSnapshot() { bIsPartyStateSnapshotDirty = true; }
+
+private:
+	FPartyStateSnapshot PartyStateSnapshot;
+	bool bIsPartyStateSnapshotDirty = true;
 #pragma endregion
 
 #pragma region "Playing With Party"
@@ -258,4 +267,10 @@ public:
 	TDelegate<bool(const EGameModeType GameModeType)> ValidateToStartMatchmaking;
 	TDelegate<bool(const FOnlineSessionSearchResult& SessionSearchResult)> ValidateToJoinSession;
 #pragma endregion
+
+#pragma region "Lobby Essentials"
+public:
+	// Broadcast once the party and chat states are resynced after (re)connecting to the lobby.
+	virtual FOnLobbyResynced* GetOnLobbyResyncedDelegates() { return nullptr; }
+#pragma endregion
 };
@@ -87,6 +87,20 @@ DECLARE_MULTICAST_DELEGATE_TwoParams(FOnMatchSessionFindSessionsComplete, const
 
 #define ACCEPT_PARTY_INVITE_MESSAGE NSLOCTEXT(BYTEWARS_LOCTEXT_NAMESPACE, "Accept Party Invite", "Accept")
 #define REJECT_PARTY_INVITE_MESSAGE NSLOCTEXT(BYTEWARS_LOCTEXT_NAMESPACE, "Reject Party Invite", "Reject")
+
+/*
+ * Party members and leader captured from the party session, keyed by AccelByte user id.
+ * Rebuilt only after a party event, so membership checks don't need to look up the party session.
+ */
+struct FPartyStateSnapshot
+{
+	FString PartySessionId;
+	TSet<FString> MemberIds;
+	FString LeaderId;
+
+	// Increased each time the party members or leader change.
+	uint32 Version = 0;
+};
 #pragma endregion
 
 #pragma region "Lobby"
@@ -101,4 +115,11 @@ DECLARE_MULTICAST_DELEGATE_TwoParams(FOnMatchSessionFindSessionsComplete, const
 
 #define LOBBY_CONNECTION_CLOSED_AUTO_CONNET_MESSAGE NSLOCTEXT(BYTEWARS_LOCTEXT_NAMESPACE, "Lobby Connection Closed Auto Connect", "Disconnected from AGS. Reconnecting.")
 // @@@SNIPEND
+
+#define LOBBY_RECONNECT_MAX_ATTEMPTS 5
+#define LOBBY_RECONNECT_BASE_DELAY 1.0f
+#define LOBBY_RECONNECT_MAX_DELAY 30.0f
+#define LOBBY_RESYNC_CHAT_TIMEOUT 10.0f
+
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnLobbyResynced, const int32 /*LocalUserNum*/, const bool /*bWasReconnected*/);
 #pragma endregion
\ No newline at end of file
@@ -177,7 +177,7 @@ void UPartyOnlineSession::InitializePartyGeneratedWidgets()
 				OnInviteToPartyButtonClicked(GetLocalUserNumFromPlayerController(ParentWidget->GetOwningPlayer()), FriendUserId);
 			}
 		});
-		InviteToPartyButtonMetadata->OnWidgetGenerated.AddUObject(this, &ThisClass::UpdatePartyGeneratedWidgets);
+		InviteToPartyButtonMetadata->OnWidgetGenerated.AddUObject(this, &ThisClass::UpdatePartyGeneratedWidgets, false);
 	}
 
 	// Assign action button to kick player from the party.
@@ -198,7 +198,7 @@ void UPartyOnlineSession::InitializePartyGeneratedWidgets()
 				OnKickPlayerFromPartyButtonClicked(GetLocalUserNumFromPlayerController(ParentWidget->GetOwningPlayer()), FriendUserId);
 			}
 		});
-		KickPlayerFromPartyButtonMetadata->OnWidgetGenerated.AddUObject(this, &ThisClass::UpdatePartyGeneratedWidgets);
+		KickPlayerFromPartyButtonMetadata->OnWidgetGenerated.AddUObject(this, &ThisClass::UpdatePartyGeneratedWidgets, false);
 	}
 
 	// Assign action button to promote party leader.
@@ -219,7 +219,7 @@ void UPartyOnlineSession::InitializePartyGeneratedWidgets()
 				OnPromotePartyLeaderButtonClicked(GetLocalUserNumFromPlayerController(ParentWidget->GetOwningPlayer()), FriendUserId);
 			}
 		});
-		PromotePartyLeaderButtonMetadata->OnWidgetGenerated.AddUObject(this, &ThisClass::UpdatePartyGeneratedWidgets);
+		PromotePartyLeaderButtonMetadata->OnWidgetGenerated.AddUObject(this, &ThisClass::UpdatePartyGeneratedWidgets, false);
 	}
 
 	// On party update events, update the generated widget.
@@ -227,14 +227,14 @@ void UPartyOnlineSession::InitializePartyGeneratedWidgets()
 	{
 		GetOnCreatePartyCompleteDelegates()->AddWeakLambda(this, [this](FName SessionName, bool bWasSuccessful)
 		{
-			UpdatePartyGeneratedWidgets();
+			UpdatePartyGeneratedWidgets(true);
 		});
 	}
 	if (GetOnLeavePartyCompleteDelegates())
 	{
 		GetOnLeavePartyCompleteDelegates()->AddWeakLambda(this, [this](FName SessionName, bool bWasSuccessful)
 		{
-			UpdatePartyGeneratedWidgets();
+			UpdatePartyGeneratedWidgets(true);
 		});
 	}
 
@@ -243,7 +243,7 @@ void UPartyOnlineSession::InitializePartyGeneratedWidgets()
 	{
 		GetOnPartyMembersChangeDelegates()->AddWeakLambda(this, [this](FName SessionName, const FUniqueNetId& Member, bool bJoined)
 		{
-			UpdatePartyGeneratedWidgets();
+			UpdatePartyGeneratedWidgets(true);
 		});
 	}
 #else
@@ -251,14 +251,14 @@ void UPartyOnlineSession::InitializePartyGeneratedWidgets()
 	{
 		GetOnPartyMemberJoinedDelegates()->AddWeakLambda(this, [this](FName SessionName, const FUniqueNetId& Member)
 		{
-			UpdatePartyGeneratedWidgets();
+			UpdatePartyGeneratedWidgets(true);
 		});
 	}
 	if (GetOnPartyMemberLeftDelegates())
 	{
 		GetOnPartyMemberLeftDelegates()->AddWeakLambda(this, [this](FName SessionName, const FUniqueNetId& Member, EOnSessionParticipantLeftReason Reason)
 		{
-			UpdatePartyGeneratedWidgets();
+			UpdatePartyGeneratedWidgets(true);
 		});
 	}
 #endif
@@ -267,12 +267,12 @@ void UPartyOnlineSession::InitializePartyGeneratedWidgets()
 	{
 		GetOnPartySessionUpdateReceivedDelegates()->AddWeakLambda(this, [this](FName SessionName)
 		{
-			UpdatePartyGeneratedWidgets();
+			UpdatePartyGeneratedWidgets(true);
 		});
 	}
 }
 
-void UPartyOnlineSession::UpdatePartyGeneratedWidgets()
+void UPartyOnlineSession::UpdatePartyGeneratedWidgets(const bool bSkipIfUnchanged)
 {
 	// Take local user ID reference from active widget.
 	FUniqueNetIdPtr LocalUserABId = nullptr;
@@ -284,6 +284,17 @@ void UPartyOnlineSession::UpdatePartyGeneratedWidgets()
 	// Take current displayed friend ID.
 	const FUniqueNetIdPtr FriendUserId = GetCurrentDisplayedFriendId();
 
+	// Skip if neither the party nor the displayed players changed since the last update.
+	const FString WidgetsState = FString::Printf(TEXT("%u;%s;%s"),
+		GetPartyStateSnapshot().Version,
+		LocalUserABId ? *GetPartyStateUserId(*LocalUserABId) : TEXT(""),
+		FriendUserId ? *GetPartyStateUserId(*FriendUserId) : TEXT(""));
+	if (bSkipIfUnchanged && WidgetsState.Equals(LastPartyGeneratedWidgetsState))
+	{
+		return;
+	}
+	LastPartyGeneratedWidgetsState = WidgetsState;
+
 	// Check party information.
 	const bool bIsInParty = IsInParty(LocalUserABId);
 	const bool bIsLeader = IsPartyLeader(LocalUserABId);
@@ -402,7 +413,7 @@ FUniqueNetIdPtr UPartyOnlineSession::GetCurrentDisplayedFriendId()
 }
 
 // @@@SNIPSTART PartyOnlineSession.cpp-OnInviteToPartyButtonClicked
-// @@@MULTISNIP ReadyUI {"selectedLines": ["1-11", "14"]}
+// @@@MULTISNIP ReadyUI {"selectedLines": ["1-11", "17"]}
 void UPartyOnlineSession::OnInviteToPartyButtonClicked(const int32 LocalUserNum, const FUniqueNetIdPtr& Invitee)
 {
 	// Disable the button to avoid spamming.
@@ -415,12 +426,15 @@ void UPartyOnlineSession::OnInviteToPartyButtonClicked(const int32 LocalUserNum,
 		}
 	}
 
+	// The button must be refreshed by the next party event, even if the party stays the same.
+	LastPartyGeneratedWidgetsState.Reset();
+
 	SendPartyInvite(LocalUserNum, Invitee);
 }
 // @@@SNIPEND
 
 // @@@SNIPSTART PartyOnlineSession.cpp-OnKickPlayerFromPartyButtonClicked
-// @@@MULTISNIP ReadyUI {"selectedLines": ["1-11", "14"]}
+// @@@MULTISNIP ReadyUI {"selectedLines": ["1-11", "17"]}
 void UPartyOnlineSession::OnKickPlayerFromPartyButtonClicked(const int32 LocalUserNum, const FUniqueNetIdPtr& KickedPlayer)
 {
 	// Disable the button to avoid spamming.
@@ -433,12 +447,15 @@ void UPartyOnlineSession::OnKickPlayerFromPartyButtonClicked(const int32 LocalUs
 		}
 	}
 
+	// The button must be refreshed by the next party event, even if the party stays the same.
+	LastPartyGeneratedWidgetsState.Reset();
+
 	KickPlayerFromParty(LocalUserNum, KickedPlayer);
 }
 // @@@SNIPEND
 
 // @@@SNIPSTART PartyOnlineSession.cpp-OnPromotePartyLeaderButtonClicked
-// @@@MULTISNIP ReadyUI {"selectedLines": ["1-11", "14"]}
+// @@@MULTISNIP ReadyUI {"selectedLines": ["1-11", "17"]}
 void UPartyOnlineSession::OnPromotePartyLeaderButtonClicked(const int32 LocalUserNum, const FUniqueNetIdPtr& NewLeader)
 {
 	// Disable the button to avoid spamming.
@@ -451,6 +468,9 @@ void UPartyOnlineSession::OnPromotePartyLeaderButtonClicked(const int32 LocalUse
 		}
 	}
 
+	// The button must be refreshed by the next party event, even if the party stays the same.
+	LastPartyGeneratedWidgetsState.Reset();
+
 	PromotePartyLeader(LocalUserNum, NewLeader);
 }
 // @@@SNIPEND
@@ -498,33 +518,21 @@ FUniqueNetIdPtr UPartyOnlineSession::GetPartyLeader()
 // @@@SNIPSTART PartyOnlineSession.cpp-IsInParty
 bool UPartyOnlineSession::IsInParty(const FUniqueNetIdPtr UserId)
 {
-	if (!UserId)
-	{
-		return false;
-	}
-
-	const TArray<FUniqueNetIdRef> Members = GetPartyMembers();
-	for (const auto& Member : Members)
-	{
-		if (!Member.Get().IsValid())
-		{
-			continue;
-		}
-
-		if (Member.Get() == UserId.ToSharedRef().Get())
-		{
-			return true;
-		}
-	}
-
-	return false;
+	// Look up the cached party state instead of the party session's registered players.
+	return UserId && GetPartyStateSnapshot().MemberIds.Contains(GetPartyStateUserId(*UserId));
 }
 // @@@SNIPEND
 
 // @@@SNIPSTART PartyOnlineSession.cpp-IsPartyLeader
 bool UPartyOnlineSession::IsPartyLeader(const FUniqueNetIdPtr UserId)
 {
-	return GetPartyLeader() && UserId && UserId.ToSharedRef().Get() == GetPartyLeader().ToSharedRef().Get();
+	if (!UserId)
+	{
+		return false;
+	}
+
+	const FString& LeaderId = GetPartyStateSnapshot().LeaderId;
+	return !LeaderId.IsEmpty() && LeaderId.Equals(GetPartyStateUserId(*UserId));
 }
 // @@@SNIPEND
 
@@ -882,10 +890,12 @@ void UPartyOnlineSession::PromotePartyLeader(const int32 LocalUserNum, const FUn
 // @@@SNIPEND
 
 // @@@SNIPSTART PartyOnlineSession.cpp-OnCreatePartyComplete
-// @@@MULTISNIP CachePartyLeader {"highlightedLines": "{17-18}"}
-// @@@MULTISNIP ResetMemberStatus {"highlightedLines": "{20-21}"}
+// @@@MULTISNIP CachePartyLeader {"highlightedLines": "{19-20}"}
+// @@@MULTISNIP ResetMemberStatus {"highlightedLines": "{22-23}"}
 void UPartyOnlineSession::OnCreatePartyComplete(FName SessionName, bool bSucceeded)
 {
+	InvalidatePartyStateSnapshot();
+
 	if (SessionName != GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession))
 	{
 		return;
@@ -913,6 +923,8 @@ void UPartyOnlineSession::OnCreatePartyComplete(FName SessionName, bool bSucceed
 // @@@SNIPSTART PartyOnlineSession.cpp-OnLeavePartyComplete
 void UPartyOnlineSession::OnLeavePartyComplete(FName SessionName, bool bSucceeded)
 {
+	InvalidatePartyStateSnapshot();
+
 	if (SessionName != GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession))
 	{
 		return;
@@ -965,10 +977,12 @@ void UPartyOnlineSession::OnSendPartyInviteComplete(const FUniqueNetId& Sender,
 // @@@SNIPEND
 
 // @@@SNIPSTART PartyOnlineSession.cpp-OnJoinPartyComplete
-// @@@MULTISNIP CachePartyLeader {"highlightedLines": "{17-18}"}
-// @@@MULTISNIP ResetMemberStatus {"highlightedLines": "{20-21}"}
+// @@@MULTISNIP CachePartyLeader {"highlightedLines": "{19-20}"}
+// @@@MULTISNIP ResetMemberStatus {"highlightedLines": "{22-23}"}
 void UPartyOnlineSession::OnJoinPartyComplete(FName SessionName, EOnJoinSessionCompleteResult::Type Result)
 {
+	InvalidatePartyStateSnapshot();
+
 	if (SessionName != GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession))
 	{
 		return;
@@ -1168,6 +1182,8 @@ void UPartyOnlineSession::DisplayJoinPartyConfirmation(const int32 LocalUserNum,
 // @@@SNIPSTART PartyOnlineSession.cpp-OnKickPlayerFromPartyComplete
 void UPartyOnlineSession::OnKickPlayerFromPartyComplete(bool bWasSuccessful, const FUniqueNetId& KickedPlayer)
 {
+	InvalidatePartyStateSnapshot();
+
 	const FUniqueNetIdAccelByteUserRef KickedPlayerABId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(KickedPlayer.AsShared());
 	if (bWasSuccessful)
 	{
@@ -1188,6 +1204,8 @@ void UPartyOnlineSession::OnKickPlayerFromPartyComplete(bool bWasSuccessful, con
 // @@@SNIPSTART PartyOnlineSession.cpp-OnKickedFromParty
 void UPartyOnlineSession::OnKickedFromParty(FName SessionName)
 {
+	InvalidatePartyStateSnapshot();
+
 	// Abort if not a party session.
 	if (SessionName != GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession))
 	{
@@ -1209,6 +1227,8 @@ void UPartyOnlineSession::OnKickedFromParty(FName SessionName)
 // @@@SNIPSTART PartyOnlineSession.cpp-OnPromotePartyLeaderComplete
 void UPartyOnlineSession::OnPromotePartyLeaderComplete(const FUniqueNetId& NewLeader, const FOnlineError& Result)
 {
+	InvalidatePartyStateSnapshot();
+
 	const FUniqueNetIdAccelByteUserRef NewLeaderABId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(NewLeader.AsShared());
 	if (Result.bSucceeded)
 	{
@@ -1273,6 +1293,8 @@ void UPartyOnlineSession::DisplayCurrentPartyLeader()
 // @@@SNIPSTART PartyOnlineSession.cpp-OnPartyMembersChange
 void UPartyOnlineSession::OnPartyMembersChange(FName SessionName, const FUniqueNetId& Member, bool bJoined)
 {
+	InvalidatePartyStateSnapshot();
+
 	// Abort if not a party session.
 	if (SessionName != GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession))
 	{
@@ -1355,6 +1377,8 @@ void UPartyOnlineSession::OnPartyMembersChange(FName SessionName, const FUniqueN
 // @@@SNIPSTART PartyOnlineSession.cpp-OnPartyMemberJoined
 void UPartyOnlineSession::OnPartyMemberJoined(FName SessionName, const FUniqueNetId& Member)
 {
+	InvalidatePartyStateSnapshot();
+
 	// Abort if not a party session.
 	if (SessionName != GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession))
 	{
@@ -1434,6 +1458,8 @@ void UPartyOnlineSession::OnPartyMemberJoined(FName SessionName, const FUniqueNe
 // @@@SNIPSTART PartyOnlineSession.cpp-OnPartyMemberLeft
 void UPartyOnlineSession::OnPartyMemberLeft(FName SessionName, const FUniqueNetId& Member, EOnSessionParticipantLeftReason Reason)
 {
+	InvalidatePartyStateSnapshot();
+
 	// Abort if not a party session.
 	if (SessionName != GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession))
 	{
@@ -1515,6 +1541,8 @@ void UPartyOnlineSession::OnPartyMemberLeft(FName SessionName, const FUniqueNetI
 // @@@SNIPSTART PartyOnlineSession.cpp-OnPartySessionUpdateReceived
 void UPartyOnlineSession::OnPartySessionUpdateReceived(FName SessionName)
 {
+	InvalidatePartyStateSnapshot();
+
 	// Abort if not a party session.
 	if (SessionName != GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession))
 	{
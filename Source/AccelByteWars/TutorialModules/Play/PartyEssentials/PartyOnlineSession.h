@@ -146,7 +146,7 @@ protected:
 	void OnLeavePartyToTriggerEvent(FName SessionName, bool bSucceeded, const TDelegate<void(bool bWasSuccessful)> OnComplete);
 
 	void InitializePartyGeneratedWidgets();
-	void UpdatePartyGeneratedWidgets();
+	void UpdatePartyGeneratedWidgets(const bool bSkipIfUnchanged = false);
 	void DeinitializePartyGeneratedWidgets();
 	FUniqueNetIdPtr GetCurrentDisplayedFriendId();
 
@@ -240,4 +240,8 @@ private:
 	FOnSessionUpdateReceived OnPartySessionUpdateReceivedDelegates;
 #pragma endregion
 // @@@SNIPEND
+
+private:
+	// Party state and displayed players the generated widgets were last updated with.
+	FString LastPartyGeneratedWidgetsState;
 };
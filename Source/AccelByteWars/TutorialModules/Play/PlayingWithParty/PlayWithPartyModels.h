@@ -28,4 +28,9 @@
 
 #define PARTY_GAME_SESSION_LEADER_SAFEGUARD_MESSAGE NSLOCTEXT(ACCELBYTEWARS_LOCTEXT_NAMESPACE, "Party Game Session Leader Safeguard", "Cannot play online session since party members are on other session")
 #define PARTY_GAME_SESSION_MEMBER_SAFEGUARD_MESSAGE NSLOCTEXT(ACCELBYTEWARS_LOCTEXT_NAMESPACE, "Party Game Session Member Safeguard", "Only party leader can start online session")
-// @@@SNIPEND
\ No newline at end of file
+// @@@SNIPEND
+
+// Failed party member game session updates are retried on top of the latest party session version with a bounded backoff.
+#define PARTY_MEMBER_GAME_SESSION_UPDATE_MAX_RETRIES 5
+#define PARTY_MEMBER_GAME_SESSION_UPDATE_RETRY_BASE_DELAY 0.5f
+#define PARTY_MEMBER_GAME_SESSION_UPDATE_RETRY_MAX_DELAY 8.0f
\ No newline at end of file
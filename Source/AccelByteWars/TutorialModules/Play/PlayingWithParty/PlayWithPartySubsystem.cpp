@@ -196,7 +196,7 @@ void UPlayWithPartySubsystem::OnStartPartyMatchmakingComplete()
 
 	// Abort if not a party matchmaking.
 	if (!GetSessionInterface()->IsInPartySession() ||
-		GetOnlineSession()->GetPartyMembers().Num() <= 1)
+		GetOnlineSession()->GetPartyStateSnapshot().MemberIds.Num() <= 1)
 	{
 		return;
 	}
@@ -234,7 +234,7 @@ void UPlayWithPartySubsystem::OnPartyMatchmakingComplete(FName SessionName, bool
 
 	// Abort if not a party matchmaking.
 	if (!GetSessionInterface()->IsInPartySession() ||
-		GetOnlineSession()->GetPartyMembers().Num() <= 1 ||
+		GetOnlineSession()->GetPartyStateSnapshot().MemberIds.Num() <= 1 ||
 		!GetOnlineSession()->GetPredefinedSessionNameFromType(EAccelByteV2SessionType::GameSession).IsEqual(SessionName))
 	{
 		return;
@@ -288,7 +288,7 @@ void UPlayWithPartySubsystem::OnPartyMatchmakingCanceled()
 
 	// Abort if not a party matchmaking.
 	if (!GetSessionInterface()->IsInPartySession() ||
-		GetOnlineSession()->GetPartyMembers().Num() <= 1)
+		GetOnlineSession()->GetPartyStateSnapshot().MemberIds.Num() <= 1)
 	{
 		return;
 	}
@@ -326,7 +326,7 @@ void UPlayWithPartySubsystem::OnPartyMatchmakingExpired(TSharedPtr<FOnlineSessio
 
 	// Abort if not a party matchmaking.
 	if (!GetSessionInterface()->IsInPartySession() ||
-		GetOnlineSession()->GetPartyMembers().Num() <= 1)
+		GetOnlineSession()->GetPartyStateSnapshot().MemberIds.Num() <= 1)
 	{
 		return;
 	}
@@ -381,7 +381,7 @@ void UPlayWithPartySubsystem::InvitePartyMembersToJoinPartyGameSession(const FUn
 	}
 
 	// Not necessary to send party game session invitation if there is only one member.
-	if (GetOnlineSession()->GetPartyMembers().Num() <= 1)
+	if (GetOnlineSession()->GetPartyStateSnapshot().MemberIds.Num() <= 1)
 	{
 		return;
 	}
@@ -419,7 +419,7 @@ void UPlayWithPartySubsystem::OnPartyGameSessionInviteReceived(const FUniqueNetI
 	if (Invite.SessionType != EAccelByteV2SessionType::GameSession ||
 		!GetSessionInterface()->IsInPartySession() ||
 		!GetOnlineSession()->IsPartyLeader(FromId.AsShared()) ||
-		GetOnlineSession()->GetPartyMembers().Num() <= 1)
+		GetOnlineSession()->GetPartyStateSnapshot().MemberIds.Num() <= 1)
 	{
 		return;
 	}
@@ -475,42 +475,35 @@ void UPlayWithPartySubsystem::UpdatePartyMemberGameSession(const FUniqueNetIdPtr
 		return;
 	}
 
+	// Wait for the ongoing party member game session update, the change is sent along with the next one.
+	if (!QueuePartyMemberGameSessionChange(MemberUserId, bResetGameSessionId))
+	{
+		return;
+	}
+
 	GetSessionInterface()->RefreshSession(
 		GetOnlineSession()->GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession), 
-		FOnRefreshSessionComplete::CreateWeakLambda(this, [this, MemberUserId, bResetGameSessionId](bool bWasSuccessful)
+		FOnRefreshSessionComplete::CreateWeakLambda(this, [this](bool bWasSuccessful)
 		{
 			if (!bWasSuccessful) 
 			{
 				UE_LOG_PLAYINGWITHPARTY(Warning, TEXT("Cannot update party member game session. Failed to refresh party session."));
+				CompletePartyMemberGameSessionChanges(false);
 				return;
 			}
 
 			FNamedOnlineSession* GameSession = GetSessionInterface()->GetNamedSession(
 				GetOnlineSession()->GetPredefinedSessionNameFromType(EAccelByteV2SessionType::GameSession));
 
-			// Get game session id only if it has dedicated server or host.
-			FString GameSessionId = TEXT("");
-			if (GameSession && !bResetGameSessionId)
-			{
-				FString ServerAddress = TEXT("");
-				GetSessionInterface()->GetResolvedConnectString(GameSession->SessionName, ServerAddress);
-				const bool bIsP2PHost = GetSessionInterface()->IsPlayerP2PHost(MemberUserId.ToSharedRef().Get(), GameSession->SessionName);
-
-				if (!ServerAddress.IsEmpty() || bIsP2PHost) 
-				{
-					GameSessionId = GameSession->GetSessionIdStr();
-				}
-			}
-
 			FNamedOnlineSession* PartySession = GetSessionInterface()->GetPartySession();
 			if (!PartySession)
 			{
 				UE_LOG_PLAYINGWITHPARTY(Warning, TEXT("Cannot update party member game session. Party session is not valid."));
+				AbortPartyMemberGameSessionChanges();
 				return;
 			}
 
 			// Construct party game session data.
-			const FUniqueNetIdAccelByteUserRef MemberUserABId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(MemberUserId.ToSharedRef());
 			TSharedPtr<FJsonObject> MembersGameSessionId = MakeShareable(new FJsonObject);
 			FOnlineSessionSetting PartyGameSessionSetting;
 			if (PartySession->SessionSettings.Settings.Contains(PARTY_MEMBERS_GAME_SESSION_ID))
@@ -520,42 +513,59 @@ void UPlayWithPartySubsystem::UpdatePartyMemberGameSession(const FUniqueNetIdPtr
 				if (!FJsonSerializer::Deserialize(JsonReader, MembersGameSessionId))
 				{
 					UE_LOG_PLAYINGWITHPARTY(Warning, TEXT("Cannot update party member game session. Failed to parse party members game session."));
+					AbortPartyMemberGameSessionChanges();
 					return;
 				}
 			}
 
-			// Update party member game session id.
+			// Update party members game session id.
 			if (!MembersGameSessionId)
 			{
 				UE_LOG_PLAYINGWITHPARTY(Warning, TEXT("Cannot update party member game session. Failed to parse party members game session."));
+				AbortPartyMemberGameSessionChanges();
 				return;
 			}
-			MembersGameSessionId->RemoveField(MemberUserABId->GetAccelByteId());
-			if (!GameSessionId.IsEmpty())
+			for (const TPair<FString, FPartyMemberGameSessionChange>& Change : InFlightPartyMemberGameSessionChanges)
 			{
-				MembersGameSessionId->SetStringField(MemberUserABId->GetAccelByteId(), GameSessionId);
+				// Get game session id only if it has dedicated server or host.
+				FString GameSessionId = TEXT("");
+				if (GameSession && !Change.Value.bResetGameSessionId)
+				{
+					FString ServerAddress = TEXT("");
+					GetSessionInterface()->GetResolvedConnectString(GameSession->SessionName, ServerAddress);
+					const bool bIsP2PHost = GetSessionInterface()->IsPlayerP2PHost(Change.Value.MemberUserId.ToSharedRef().Get(), GameSession->SessionName);
+
+					if (!ServerAddress.IsEmpty() || bIsP2PHost) 
+					{
+						GameSessionId = GameSession->GetSessionIdStr();
+					}
+				}
+
+				MembersGameSessionId->RemoveField(Change.Key);
+				if (!GameSessionId.IsEmpty())
+				{
+					MembersGameSessionId->SetStringField(Change.Key, GameSessionId);
+				}
 			}
 
 			// Remove invalid party member data.
-			for (auto Pair : MembersGameSessionId->Values)
+			TArray<FString> InvalidMemberIds;
+			for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : MembersGameSessionId->Values)
 			{
-				bool bIsValidMember = false;
-
-				for (auto& ValidMember : PartySession->RegisteredPlayers)
+				const bool bIsValidMember = PartySession->RegisteredPlayers.ContainsByPredicate([&Pair](const FUniqueNetIdRef& ValidMember)
 				{
-					const FUniqueNetIdAccelByteUserRef ValidMemberUserABId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(ValidMember);
-					if (Pair.Key.Equals(ValidMemberUserABId->GetAccelByteId()))
-					{
-						bIsValidMember = true;
-						break;
-					}
-				}
+					return Pair.Key.Equals(UAccelByteWarsOnlineSessionBase::GetPartyStateUserId(ValidMember.Get()));
+				});
 
 				if (!bIsValidMember)
 				{
-					MembersGameSessionId->RemoveField(Pair.Key);
+					InvalidMemberIds.Add(Pair.Key);
 				}
 			}
+			for (const FString& InvalidMemberId : InvalidMemberIds)
+			{
+				MembersGameSessionId->RemoveField(InvalidMemberId);
+			}
 
 			// Update party game session data to the party session settings.
 			FString MembersGameSessionIdStr;
@@ -563,6 +573,14 @@ void UPlayWithPartySubsystem::UpdatePartyMemberGameSession(const FUniqueNetIdPtr
 			if (!FJsonSerializer::Serialize(MembersGameSessionId.ToSharedRef(), JsonWriter))
 			{
 				UE_LOG_PLAYINGWITHPARTY(Warning, TEXT("Cannot update party member game session. Failed to parse party members game session."));
+				AbortPartyMemberGameSessionChanges();
+				return;
+			}
+
+			// Skip the update if the latest party session already has the changes.
+			if (MembersGameSessionIdStr.Equals(PartyGameSessionSetting.Data.ToString()))
+			{
+				CompletePartyMemberGameSessionChanges(true);
 				return;
 			}
 			PartyGameSessionSetting.Data = MembersGameSessionIdStr;
@@ -570,9 +588,7 @@ void UPlayWithPartySubsystem::UpdatePartyMemberGameSession(const FUniqueNetIdPtr
 			// Update party game session to store party game session data.
 			PartySession->SessionSettings.Settings.Remove(PARTY_MEMBERS_GAME_SESSION_ID);
 			PartySession->SessionSettings.Settings.Add(PARTY_MEMBERS_GAME_SESSION_ID, PartyGameSessionSetting);
-			GetSessionInterface()->UpdateSession(
-				GetOnlineSession()->GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession),
-				PartySession->SessionSettings);
+			SendPartyMemberGameSessionUpdate(*PartySession, MembersGameSessionIdStr);
 		}
 	));
 }
@@ -632,17 +648,17 @@ bool UPlayWithPartySubsystem::IsGameSessionDifferFromParty(const FUniqueNetIdPtr
 	}
 
 	FString MemberGameSessionIdStr;
-	for (auto& Member : GetOnlineSession()->GetPartyMembers())
+	const FString MemberUserABId = UAccelByteWarsOnlineSessionBase::GetPartyStateUserId(*MemberUserId);
+	for (const FString& MemberABId : GetOnlineSession()->GetPartyStateSnapshot().MemberIds)
 	{
 		// Not necessary to check the player itself.
-		if (Member.Get() == MemberUserId.ToSharedRef().Get())
+		if (MemberABId.Equals(MemberUserABId))
 		{
 			continue;
 		}
 
 		// Check if the current game session is the same as the party.
-		const FUniqueNetIdAccelByteUserRef MemberABId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(Member);
-		if (!MembersGameSessionId->TryGetStringField(MemberABId->GetAccelByteId(), MemberGameSessionIdStr))
+		if (!MembersGameSessionId->TryGetStringField(MemberABId, MemberGameSessionIdStr))
 		{
 			continue;
 		}
@@ -854,6 +870,17 @@ void UPlayWithPartySubsystem::OnPartyGameSessionUpdateConflictError(FName Sessio
 		return;
 	}
 
+	// Retry the party member game session changes on top of the latest party session version.
+	if (GetOnlineSession()->GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession).IsEqual(SessionName))
+	{
+		if (IsSentPartyMemberGameSessionUpdate(FailedSessionSettings))
+		{
+			UE_LOG_PLAYINGWITHPARTY(Log, TEXT("Party session update conflicted with another update. Retrying party member game session changes."));
+			CompletePartyMemberGameSessionChanges(false);
+		}
+		return;
+	}
+
 	// Abort if not a party game session.
 	if (!GetSessionInterface()->IsInPartySession() ||
 		!GetOnlineSession()->GetPredefinedSessionNameFromType(EAccelByteV2SessionType::GameSession).IsEqual(SessionName))
@@ -1109,7 +1136,7 @@ bool UPlayWithPartySubsystem::ValidateToJoinPartyGameSession(const FOnlineSessio
 
 	bool bResult =
 		(SessionSearchResult.Session.SessionSettings.NumPublicConnections - ActiveMemberCount) >=
-		GetOnlineSession()->GetPartyMembers().Num();
+		GetOnlineSession()->GetPartyStateSnapshot().MemberIds.Num();
 
 	// Notify that no more slots to join the session.
 	if (!bResult && GetPromptSubystem())
@@ -1152,7 +1179,7 @@ bool UPlayWithPartySubsystem::ValidateToStartPartyMatchmaking(const EGameModeTyp
 	}
 
 	// Check whether matchmaking with party is supported using the specified game mode.
-	if (GetOnlineSession()->GetPartyMembers().Num() <= 1)
+	if (GetOnlineSession()->GetPartyStateSnapshot().MemberIds.Num() <= 1)
 	{
 		return true;
 	}
@@ -1168,3 +1195,166 @@ bool UPlayWithPartySubsystem::ValidateToStartPartyMatchmaking(const EGameModeTyp
 	return bResult;
 }
 // @@@SNIPEND
+
+#pragma region "Party Member Game Session Update Queue"
+bool UPlayWithPartySubsystem::QueuePartyMemberGameSessionChange(const FUniqueNetIdPtr MemberUserId, const bool bResetGameSessionId)
+{
+	// Merge the change with the pending ones, so the party session is updated once for all of them.
+	FPartyMemberGameSessionChange& Change = PendingPartyMemberGameSessionChanges.FindOrAdd(
+		UAccelByteWarsOnlineSessionBase::GetPartyStateUserId(*MemberUserId));
+	Change.MemberUserId = MemberUserId;
+	Change.bResetGameSessionId = bResetGameSessionId;
+
+	// Wait for the ongoing update or retry delay, the pending changes are sent right after.
+	if (bIsPartyMemberGameSessionUpdateInFlight
+		|| GetGameInstance()->GetTimerManager().IsTimerActive(PartyMemberGameSessionUpdateRetryTimerHandle))
+	{
+		return false;
+	}
+
+	bIsPartyMemberGameSessionUpdateInFlight = true;
+	InFlightPartyMemberGameSessionChanges = MoveTemp(PendingPartyMemberGameSessionChanges);
+	PendingPartyMemberGameSessionChanges.Reset();
+	return true;
+}
+
+void UPlayWithPartySubsystem::FlushPartyMemberGameSessionChanges()
+{
+	if (bIsPartyMemberGameSessionUpdateInFlight || PendingPartyMemberGameSessionChanges.IsEmpty())
+	{
+		return;
+	}
+
+	if (!GetSessionInterface() || !GetOnlineSession() || !GetSessionInterface()->IsInPartySession())
+	{
+		UE_LOG_PLAYINGWITHPARTY(Warning, TEXT("Cannot update party member game session. Party member is not in a party."));
+		PendingPartyMemberGameSessionChanges.Empty();
+		return;
+	}
+
+	// Sending any of the pending changes sends all of them.
+	const FPartyMemberGameSessionChange Change = PendingPartyMemberGameSessionChanges.CreateConstIterator().Value();
+	UpdatePartyMemberGameSession(Change.MemberUserId, Change.bResetGameSessionId);
+}
+
+void UPlayWithPartySubsystem::SendPartyMemberGameSessionUpdate(const FNamedOnlineSession& PartySession, const FString& MembersGameSessionIdStr)
+{
+	for (TPair<FString, FPartyMemberGameSessionChange>& Change : InFlightPartyMemberGameSessionChanges)
+	{
+		Change.Value.RoundTrips++;
+	}
+
+	// Remember the sent data, other party session updates complete through the same delegates.
+	SentPartyMembersGameSessionIdStr = MembersGameSessionIdStr;
+	OnUpdatePartySessionForMemberChangesDelegateHandle = GetSessionInterface()->OnUpdateSessionCompleteDelegates.AddUObject(
+		this, &ThisClass::OnUpdatePartySessionForMemberChangesComplete);
+	if (!GetSessionInterface()->UpdateSession(PartySession.SessionName, PartySession.SessionSettings))
+	{
+		CompletePartyMemberGameSessionChanges(false);
+	}
+}
+
+bool UPlayWithPartySubsystem::IsSentPartyMemberGameSessionUpdate(const FOnlineSessionSettings& SessionSettings) const
+{
+	if (!OnUpdatePartySessionForMemberChangesDelegateHandle.IsValid())
+	{
+		return false;
+	}
+
+	const FOnlineSessionSetting* Setting = SessionSettings.Settings.Find(PARTY_MEMBERS_GAME_SESSION_ID);
+	return Setting && Setting->Data.ToString().Equals(SentPartyMembersGameSessionIdStr);
+}
+
+void UPlayWithPartySubsystem::OnUpdatePartySessionForMemberChangesComplete(FName SessionName, bool bWasSuccessful)
+{
+	if (!GetSessionInterface() || !GetOnlineSession()
+		|| !GetOnlineSession()->GetPredefinedSessionNameFromType(EAccelByteV2SessionType::PartySession).IsEqual(SessionName))
+	{
+		return;
+	}
+
+	/**
+	 * Ignore completions of party session updates sent by others. The party session keeps the sent data until another
+	 * update result replaces it, so a failure of another update may still be taken as ours. That only causes a retry,
+	 * which refreshes the party session first, and the late completion of ours is ignored since it is no longer tracked.
+	 */
+	const FNamedOnlineSession* PartySession = GetSessionInterface()->GetPartySession();
+	if (!PartySession || !IsSentPartyMemberGameSessionUpdate(PartySession->SessionSettings))
+	{
+		return;
+	}
+
+	CompletePartyMemberGameSessionChanges(bWasSuccessful);
+}
+
+void UPlayWithPartySubsystem::AbortPartyMemberGameSessionChanges()
+{
+	InFlightPartyMemberGameSessionChanges.Empty();
+	CompletePartyMemberGameSessionChanges(true);
+}
+
+void UPlayWithPartySubsystem::CompletePartyMemberGameSessionChanges(const bool bSucceeded)
+{
+	bIsPartyMemberGameSessionUpdateInFlight = false;
+
+	if (GetSessionInterface())
+	{
+		GetSessionInterface()->OnUpdateSessionCompleteDelegates.Remove(OnUpdatePartySessionForMemberChangesDelegateHandle);
+	}
+	OnUpdatePartySessionForMemberChangesDelegateHandle.Reset();
+	SentPartyMembersGameSessionIdStr.Empty();
+
+	if (bSucceeded)
+	{
+		for (const TPair<FString, FPartyMemberGameSessionChange>& Change : InFlightPartyMemberGameSessionChanges)
+		{
+			UE_LOG_PLAYINGWITHPARTY(Log, TEXT("Party member %s game session updated in %d round trip(s)."), *Change.Key, Change.Value.RoundTrips);
+		}
+
+		InFlightPartyMemberGameSessionChanges.Empty();
+		PartyMemberGameSessionUpdateRetryAttempts = 0;
+		FlushPartyMemberGameSessionChanges();
+		return;
+	}
+
+	PartyMemberGameSessionUpdateRetryAttempts++;
+	if (PartyMemberGameSessionUpdateRetryAttempts > PARTY_MEMBER_GAME_SESSION_UPDATE_MAX_RETRIES)
+	{
+		UE_LOG_PLAYINGWITHPARTY(Warning, TEXT("Failed to update party member game session after %d attempts."), PartyMemberGameSessionUpdateRetryAttempts);
+
+		InFlightPartyMemberGameSessionChanges.Empty();
+		PartyMemberGameSessionUpdateRetryAttempts = 0;
+		FlushPartyMemberGameSessionChanges();
+		return;
+	}
+
+	// Rebase the failed changes under the newer pending ones, keeping their round trip count.
+	for (TPair<FString, FPartyMemberGameSessionChange>& Change : InFlightPartyMemberGameSessionChanges)
+	{
+		if (FPartyMemberGameSessionChange* PendingChange = PendingPartyMemberGameSessionChanges.Find(Change.Key))
+		{
+			PendingChange->RoundTrips = Change.Value.RoundTrips;
+		}
+		else
+		{
+			PendingPartyMemberGameSessionChanges.Add(Change.Key, MoveTemp(Change.Value));
+		}
+	}
+	InFlightPartyMemberGameSessionChanges.Empty();
+
+	// Exponential backoff with jitter, so the party members don't retry in lockstep.
+	const float Delay = FMath::Min(
+		PARTY_MEMBER_GAME_SESSION_UPDATE_RETRY_BASE_DELAY * FMath::Pow(2.0f, static_cast<float>(PartyMemberGameSessionUpdateRetryAttempts - 1)),
+		PARTY_MEMBER_GAME_SESSION_UPDATE_RETRY_MAX_DELAY);
+	GetGameInstance()->GetTimerManager().SetTimer(
+		PartyMemberGameSessionUpdateRetryTimerHandle,
+		FTimerDelegate::CreateWeakLambda(this, [this]()
+		{
+			// The timer counts as active while it executes, so release it before sending the pending changes.
+			PartyMemberGameSessionUpdateRetryTimerHandle.Invalidate();
+			FlushPartyMemberGameSessionChanges();
+		}),
+		Delay + FMath::FRandRange(0.0f, Delay * 0.5f),
+		false);
+}
+#pragma endregion
@@ -76,4 +76,38 @@ protected:
 
 	UPromptSubsystem* GetPromptSubystem();
 // @@@SNIPEND
+
+#pragma region "Party Member Game Session Update Queue"
+private:
+	struct FPartyMemberGameSessionChange
+	{
+		FUniqueNetIdPtr MemberUserId;
+		bool bResetGameSessionId = false;
+
+		// Number of party session updates sent until the change is applied.
+		int32 RoundTrips = 0;
+	};
+
+	/**
+	 * @brief Record the member change and start sending the pending changes if no update is ongoing.
+	 * @return False if the change is waiting to be sent along with the next update.
+	 */
+	bool QueuePartyMemberGameSessionChange(const FUniqueNetIdPtr MemberUserId, const bool bResetGameSessionId);
+	void FlushPartyMemberGameSessionChanges();
+	void SendPartyMemberGameSessionUpdate(const FNamedOnlineSession& PartySession, const FString& MembersGameSessionIdStr);
+	bool IsSentPartyMemberGameSessionUpdate(const FOnlineSessionSettings& SessionSettings) const;
+	void OnUpdatePartySessionForMemberChangesComplete(FName SessionName, bool bWasSuccessful);
+	void AbortPartyMemberGameSessionChanges();
+	void CompletePartyMemberGameSessionChanges(const bool bSucceeded);
+
+	// Changes are merged by member AccelByte id, so each member is written once per party session update.
+	TMap<FString, FPartyMemberGameSessionChange> PendingPartyMemberGameSessionChanges;
+	TMap<FString, FPartyMemberGameSessionChange> InFlightPartyMemberGameSessionChanges;
+
+	bool bIsPartyMemberGameSessionUpdateInFlight = false;
+	int32 PartyMemberGameSessionUpdateRetryAttempts = 0;
+	FTimerHandle PartyMemberGameSessionUpdateRetryTimerHandle;
+	FDelegateHandle OnUpdatePartySessionForMemberChangesDelegateHandle;
+	FString SentPartyMembersGameSessionIdStr;
+#pragma endregion
 };
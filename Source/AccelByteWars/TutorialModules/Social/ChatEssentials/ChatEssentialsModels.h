@@ -21,6 +21,9 @@ public:
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FChatOnSubmit, const FText&);
 
+// Max number of messages kept per chat room by the chat message store.
+#define CHAT_MESSAGE_STORE_CAPACITY 500
+
 #define ACCELBYTEWARS_LOCTEXT_NAMESPACE "AccelByteWars"
 
 #define CHAT_LOCAL_SENDER_DEFAULT_USERNAME NSLOCTEXT(ACCELBYTEWARS_LOCTEXT_NAMESPACE, "Chat Local Sender Default Username", "You")
@@ -0,0 +1,95 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#include "Social/ChatEssentials/ChatMessageStore.h"
+
+int64 FChatMessageStore::AddMessage(const FChatRoomId& RoomId, const TSharedRef<FChatMessage>& Message)
+{
+	FChatRoomMessages& Room = Rooms.FindOrAdd(RoomId);
+
+	// Messages replayed by the chat service keep the sequence number they were stored with.
+	const FString Key = MakeMessageKey(Message.Get());
+	if (const int64* StoredSequence = Room.SequencesByKey.Find(Key))
+	{
+		return *StoredSequence;
+	}
+
+	// Once the history is full, don't bring back messages that were already evicted.
+	const bool bIsFull = Room.Messages.Num() >= CHAT_MESSAGE_STORE_CAPACITY;
+	if (bIsFull && Message->GetTimestamp() < Room.Messages[Room.OldestIndex].Message->GetTimestamp())
+	{
+		return INDEX_NONE;
+	}
+
+	const int64 Sequence = ++Room.LastSequence;
+	if (bIsFull)
+	{
+		FStoredChatMessage& Oldest = Room.Messages[Room.OldestIndex];
+		Room.SequencesByKey.Remove(Oldest.Key);
+
+		Oldest.Sequence = Sequence;
+		Oldest.Key = Key;
+		Oldest.Message = Message;
+		Room.OldestIndex = (Room.OldestIndex + 1) % Room.Messages.Num();
+	}
+	else
+	{
+		Room.Messages.Add(FStoredChatMessage{ Sequence, Key, Message });
+	}
+
+	Room.SequencesByKey.Add(Key, Sequence);
+	return Sequence;
+}
+
+void FChatMessageStore::AddMessages(const FChatRoomId& RoomId, const TArray<TSharedRef<FChatMessage>>& Messages)
+{
+	for (int32 Index = Messages.Num() - 1; Index >= 0; --Index)
+	{
+		AddMessage(RoomId, Messages[Index]);
+	}
+}
+
+int64 FChatMessageStore::GetMessagesSince(const FChatRoomId& RoomId, const int64 AfterSequence, TArray<TSharedRef<FChatMessage>>& OutMessages) const
+{
+	OutMessages.Reset();
+
+	const FChatRoomMessages* Room = Rooms.Find(RoomId);
+	if (!Room || Room->Messages.IsEmpty())
+	{
+		return 0;
+	}
+
+	// Sequence numbers in the ring buffer are contiguous, so the messages can be located without searching.
+	const int32 NumMessages = Room->Messages.Num();
+	const int64 OldestSequence = Room->LastSequence - NumMessages + 1;
+	const int64 FirstSequence = FMath::Max(AfterSequence + 1, OldestSequence);
+
+	OutMessages.Reserve(FMath::Max<int64>(Room->LastSequence - FirstSequence + 1, 0));
+	for (int64 Sequence = FirstSequence; Sequence <= Room->LastSequence; ++Sequence)
+	{
+		const int32 Index = (Room->OldestIndex + static_cast<int32>(Sequence - OldestSequence)) % NumMessages;
+		OutMessages.Add(Room->Messages[Index].Message);
+	}
+
+	return Room->LastSequence;
+}
+
+int64 FChatMessageStore::GetLastSequence(const FChatRoomId& RoomId) const
+{
+	const FChatRoomMessages* Room = Rooms.Find(RoomId);
+	return Room ? Room->LastSequence : 0;
+}
+
+void FChatMessageStore::Reset()
+{
+	Rooms.Empty();
+}
+
+FString FChatMessageStore::MakeMessageKey(const FChatMessage& Message)
+{
+	return FString::Printf(TEXT("%s;%lld;%08x"),
+		*Message.GetUserId()->ToString(),
+		Message.GetTimestamp().GetTicks(),
+		GetTypeHash(Message.GetBody()));
+}
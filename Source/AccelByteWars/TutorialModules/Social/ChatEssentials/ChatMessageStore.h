@@ -0,0 +1,62 @@
+// Copyright (c) 2023 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/OnlineChatInterface.h"
+#include "ChatEssentialsModels.h"
+
+/**
+ * @brief Chat history of each chat room kept in a fixed-capacity ring buffer.
+ * Every stored message gets a sequence number that increases per room, so the chat widgets
+ * can append only the messages newer than the last one they displayed.
+ * Messages replayed by the chat service (e.g. after reconnecting) are stored only once.
+ */
+class ACCELBYTEWARS_API FChatMessageStore
+{
+public:
+	/**
+	 * @brief Store a chat message if it is not stored yet.
+	 * @return The sequence number of the stored message, or INDEX_NONE if the message is older than the retained history.
+	 */
+	int64 AddMessage(const FChatRoomId& RoomId, const TSharedRef<FChatMessage>& Message);
+
+	/**
+	 * @brief Store chat messages returned by the chat interface, which are ordered from the newest to the oldest.
+	 */
+	void AddMessages(const FChatRoomId& RoomId, const TArray<TSharedRef<FChatMessage>>& Messages);
+
+	/**
+	 * @brief Get the stored messages of a room with a sequence number greater than AfterSequence, ordered from the oldest.
+	 * @return The sequence number of the newest stored message of the room, or zero if the room has no messages.
+	 */
+	int64 GetMessagesSince(const FChatRoomId& RoomId, const int64 AfterSequence, TArray<TSharedRef<FChatMessage>>& OutMessages) const;
+
+	int64 GetLastSequence(const FChatRoomId& RoomId) const;
+
+	void Reset();
+
+private:
+	struct FStoredChatMessage
+	{
+		int64 Sequence = 0;
+		FString Key;
+		TSharedRef<FChatMessage> Message;
+	};
+
+	struct FChatRoomMessages
+	{
+		// Ring buffer of up to CHAT_MESSAGE_STORE_CAPACITY messages, OldestIndex points to the oldest one once it is full.
+		TArray<FStoredChatMessage> Messages;
+		int32 OldestIndex = 0;
+		int64 LastSequence = 0;
+
+		TMap<FString, int64> SequencesByKey;
+	};
+
+	static FString MakeMessageKey(const FChatMessage& Message);
+
+	TMap<FChatRoomId, FChatRoomMessages> Rooms;
+};
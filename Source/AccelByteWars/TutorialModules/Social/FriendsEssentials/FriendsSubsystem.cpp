@@ -56,6 +56,8 @@ void UFriendsSubsystem::Deinitialize()
 	{
 		FriendsInterface->ClearOnFriendsChangeDelegate_Handle(DelegateHandle.Key, DelegateHandle.Value);
 	}
+
+	FriendListStores.Empty();
 }
 
 // @@@SNIPSTART FriendsSubsystem.cpp-GetUniqueNetIdFromPlayerController
@@ -107,39 +109,36 @@ void UFriendsSubsystem::GetCacheFriendList(const int32 LocalUserNum, bool bQuery
 		return;
 	}
 	
+	// Use the friend list store if any, only applying the changes since the last call.
+	if (FindValidFriendListStore(LocalUserNum))
+	{
+		ApplyFriendListDelta(LocalUserNum);
+		if (bQueryUserInfo)
+		{
+			ResolveFriendsUserInfo(LocalUserNum, OnComplete);
+		}
+		else
+		{
+			TArray<TSharedRef<FOnlineFriend>> StoredFriendList = GetStoredFriendList(LocalUserNum);
+			OnComplete.ExecuteIfBound(true, StoredFriendList, TEXT(""));
+		}
+		return;
+	}
+
 	// Try to get cached friend list first.
 	TArray<TSharedRef<FOnlineFriend>> CachedFriendList;
 	if (FriendsInterface->GetFriendsList(LocalUserNum, TEXT(""), CachedFriendList))
 	{
+		BuildFriendListStore(LocalUserNum, CachedFriendList);
+
 		// Then, update the cached friends' information by querying their user information.
-		TArray<FUniqueNetIdRef> FriendIds;
-		for (const TSharedRef<FOnlineFriend>& CachedFriend : CachedFriendList)
+		if (bQueryUserInfo)
 		{
-			FriendIds.Add(CachedFriend.Get().GetUserId());
+			ResolveFriendsUserInfo(LocalUserNum, OnComplete);
 		}
-
-		// Query friends' user information.
-		if (UStartupSubsystem* StartupSubsystem = GetWorld()->GetGameInstance()->GetSubsystem<UStartupSubsystem>())
+		else
 		{
-			if(bQueryUserInfo)
-			{
-				StartupSubsystem->QueryUserInfo(
-					LocalUserNum,
-					FriendIds,
-					FOnQueryUsersInfoCompleteDelegate::CreateWeakLambda(this, [this, OnComplete, LocalUserNum](
-						const FOnlineError& Error,
-						const TArray<TSharedPtr<FUserOnlineAccountAccelByte>>& UsersInfo)
-					{
-						// Refresh friends data with queried friend's user information.
-						TArray<TSharedRef<FOnlineFriend>> NewCachedFriendList{};
-						FriendsInterface->GetFriendsList(LocalUserNum, TEXT(""), NewCachedFriendList);
-						OnComplete.ExecuteIfBound(true, NewCachedFriendList, TEXT(""));
-					}));
-			}
-			else
-			{
-				OnComplete.ExecuteIfBound(true, CachedFriendList, TEXT(""));
-			}
+			OnComplete.ExecuteIfBound(true, CachedFriendList, TEXT(""));
 		}
 	}
 	// If none, request to backend then get the cached the friend list.
@@ -153,6 +152,16 @@ void UFriendsSubsystem::GetCacheFriendList(const int32 LocalUserNum, bool bQuery
 				TArray<TSharedRef<FOnlineFriend>> CachedFriendList;
 				FriendsInterface->GetFriendsList(LocalUserNum, TEXT(""), CachedFriendList);
 
+				// Reading the friend list also reads the friends' user information.
+				if (bWasSuccessful)
+				{
+					FFriendListStore& Store = BuildFriendListStore(LocalUserNum, CachedFriendList);
+					for (const TPair<FString, TSharedRef<FOnlineFriend>>& Friend : Store.Friends)
+					{
+						Store.UserInfoResolvedIds.Add(Friend.Key);
+					}
+				}
+
 				OnComplete.ExecuteIfBound(bWasSuccessful, CachedFriendList, Error);
 			}
 		));
@@ -160,6 +169,172 @@ void UFriendsSubsystem::GetCacheFriendList(const int32 LocalUserNum, bool bQuery
 }
 // @@@SNIPEND
 
+#pragma region "Friend List Store"
+UFriendsSubsystem::FFriendListStore* UFriendsSubsystem::FindValidFriendListStore(const int32 LocalUserNum)
+{
+	FFriendListStore* Store = FriendListStores.Find(LocalUserNum);
+	if (!Store)
+	{
+		return nullptr;
+	}
+
+	// The store belongs to another user that was logged in with this local user index, it needs to be rebuilt.
+	const FString LocalUserId = GetLocalUserAccelByteId(LocalUserNum);
+	if (LocalUserId.IsEmpty() || !Store->OwnerUserId.Equals(LocalUserId))
+	{
+		return nullptr;
+	}
+
+	return Store;
+}
+
+UFriendsSubsystem::FFriendListStore& UFriendsSubsystem::BuildFriendListStore(const int32 LocalUserNum, const TArray<TSharedRef<FOnlineFriend>>& FriendList)
+{
+	FFriendListStore& Store = FriendListStores.FindOrAdd(LocalUserNum);
+	Store.OwnerUserId = GetLocalUserAccelByteId(LocalUserNum);
+	Store.Friends.Reset();
+	Store.UserInfoResolvedIds.Reset();
+
+	Store.Friends.Reserve(FriendList.Num());
+	for (const TSharedRef<FOnlineFriend>& Friend : FriendList)
+	{
+		Store.Friends.Add(GetAccelByteId(Friend->GetUserId()), Friend);
+	}
+
+	UE_LOG_FRIENDS_ESSENTIALS(Log, TEXT("Friend list store is built with %d friend(s)."), Store.Friends.Num());
+	return Store;
+}
+
+void UFriendsSubsystem::ApplyFriendListDelta(const int32 LocalUserNum)
+{
+	FFriendListStore* Store = FriendListStores.Find(LocalUserNum);
+	if (!Store || !FriendsInterface)
+	{
+		return;
+	}
+
+	TArray<TSharedRef<FOnlineFriend>> FriendList;
+	if (!FriendsInterface->GetFriendsList(LocalUserNum, TEXT(""), FriendList))
+	{
+		return;
+	}
+
+	// Add new friends and refresh the existing ones, since their invite status may have changed (e.g. request accepted).
+	int32 NumAdded = 0;
+	TSet<FString> CurrentFriendIds;
+	CurrentFriendIds.Reserve(FriendList.Num());
+	for (const TSharedRef<FOnlineFriend>& Friend : FriendList)
+	{
+		const FString FriendId = GetAccelByteId(Friend->GetUserId());
+		CurrentFriendIds.Add(FriendId);
+
+		if (TSharedRef<FOnlineFriend>* StoredFriend = Store->Friends.Find(FriendId))
+		{
+			*StoredFriend = Friend;
+		}
+		else
+		{
+			Store->Friends.Add(FriendId, Friend);
+			NumAdded++;
+		}
+	}
+
+	// Remove friends that are no longer in the list (e.g. unfriended or request rejected).
+	int32 NumRemoved = 0;
+	for (auto It = Store->Friends.CreateIterator(); It; ++It)
+	{
+		if (!CurrentFriendIds.Contains(It.Key()))
+		{
+			Store->UserInfoResolvedIds.Remove(It.Key());
+			It.RemoveCurrent();
+			NumRemoved++;
+		}
+	}
+
+	if (NumAdded > 0 || NumRemoved > 0)
+	{
+		UE_LOG_FRIENDS_ESSENTIALS(Log, TEXT("Friend list store is updated. Added: %d, removed: %d."), NumAdded, NumRemoved);
+	}
+}
+
+void UFriendsSubsystem::ResolveFriendsUserInfo(const int32 LocalUserNum, const FOnGetCacheFriendListComplete& OnComplete)
+{
+	// Only query the user information of friends that were not resolved yet.
+	TArray<FUniqueNetIdRef> UnresolvedFriendIds;
+	if (const FFriendListStore* Store = FriendListStores.Find(LocalUserNum))
+	{
+		for (const TPair<FString, TSharedRef<FOnlineFriend>>& Friend : Store->Friends)
+		{
+			if (!Store->UserInfoResolvedIds.Contains(Friend.Key))
+			{
+				UnresolvedFriendIds.Add(Friend.Value->GetUserId());
+			}
+		}
+	}
+
+	UStartupSubsystem* StartupSubsystem = GetWorld()->GetGameInstance()->GetSubsystem<UStartupSubsystem>();
+	if (UnresolvedFriendIds.IsEmpty() || !StartupSubsystem)
+	{
+		TArray<TSharedRef<FOnlineFriend>> StoredFriendList = GetStoredFriendList(LocalUserNum);
+		OnComplete.ExecuteIfBound(true, StoredFriendList, TEXT(""));
+		return;
+	}
+
+	UE_LOG_FRIENDS_ESSENTIALS(Log, TEXT("Querying user information of %d friend(s)."), UnresolvedFriendIds.Num());
+	StartupSubsystem->QueryUserInfo(
+		LocalUserNum,
+		UnresolvedFriendIds,
+		FOnQueryUsersInfoCompleteDelegate::CreateWeakLambda(this, [this, OnComplete, LocalUserNum](
+			const FOnlineError& Error,
+			const TArray<TSharedPtr<FUserOnlineAccountAccelByte>>& UsersInfo)
+		{
+			if (FFriendListStore* Store = FriendListStores.Find(LocalUserNum))
+			{
+				for (const TSharedPtr<FUserOnlineAccountAccelByte>& UserInfo : UsersInfo)
+				{
+					if (UserInfo)
+					{
+						Store->UserInfoResolvedIds.Add(GetAccelByteId(UserInfo->GetUserId()));
+					}
+				}
+			}
+
+			// Refresh friends data with queried friend's user information.
+			ApplyFriendListDelta(LocalUserNum);
+			TArray<TSharedRef<FOnlineFriend>> StoredFriendList = GetStoredFriendList(LocalUserNum);
+			OnComplete.ExecuteIfBound(true, StoredFriendList, TEXT(""));
+		}));
+}
+
+TArray<TSharedRef<FOnlineFriend>> UFriendsSubsystem::GetStoredFriendList(const int32 LocalUserNum) const
+{
+	TArray<TSharedRef<FOnlineFriend>> FriendList;
+	if (const FFriendListStore* Store = FriendListStores.Find(LocalUserNum))
+	{
+		Store->Friends.GenerateValueArray(FriendList);
+	}
+	return FriendList;
+}
+
+FString UFriendsSubsystem::GetLocalUserAccelByteId(const int32 LocalUserNum) const
+{
+	const IOnlineSubsystem* Subsystem = Online::GetSubsystem(GetWorld());
+	const IOnlineIdentityPtr IdentityInterface = Subsystem ? Subsystem->GetIdentityInterface() : nullptr;
+	return IdentityInterface ? GetAccelByteId(IdentityInterface->GetUniquePlayerId(LocalUserNum)) : FString();
+}
+
+FString UFriendsSubsystem::GetAccelByteId(const FUniqueNetIdPtr UserId)
+{
+	if (!UserId.IsValid())
+	{
+		return FString();
+	}
+
+	const FUniqueNetIdAccelByteUserPtr UserABId = FUniqueNetIdAccelByteUser::TryCast(*UserId);
+	return UserABId.IsValid() ? UserABId->GetAccelByteId() : UserId->ToString();
+}
+#pragma endregion
+
 // @@@SNIPSTART FriendsSubsystem.cpp-GetSelfFriendCode
 void UFriendsSubsystem::GetSelfFriendCode(const APlayerController* PC, const FOnGetSelfFriendCodeComplete& OnComplete)
 {
@@ -608,16 +783,20 @@ void UFriendsSubsystem::CancelFriendRequest(const APlayerController* PC, const F
 void UFriendsSubsystem::GetFriendsInviteStatus(const APlayerController* PC, TArray<UFriendData*> PlayerData, const FOnGetPlayersInviteStatusComplete& OnComplete)
 {	
 	const int32 LocalUserNum = GetLocalUserNumFromPlayerController(PC);
-	GetCacheFriendList(LocalUserNum, false, FOnGetCacheFriendListComplete::CreateWeakLambda(this, [this, PlayerData, OnComplete](bool bWasSuccessful, TArray<TSharedRef<FOnlineFriend>>& CachedFriendList, const FString& ErrorMessage)
+	GetCacheFriendList(LocalUserNum, false, FOnGetCacheFriendListComplete::CreateWeakLambda(this, [this, PlayerData, OnComplete, LocalUserNum](bool bWasSuccessful, TArray<TSharedRef<FOnlineFriend>>& CachedFriendList, const FString& ErrorMessage)
 	{
 		if (bWasSuccessful)
 		{
+			// Look up each player in the id-keyed friend list store instead of scanning the friend list.
+			const FFriendListStore* Store = FriendListStores.Find(LocalUserNum);
 			for(UFriendData* Player : PlayerData)
 			{
-				const TSharedRef<FOnlineFriend>* FriendData = CachedFriendList.FindByPredicate([Player](TSharedRef<FOnlineFriend> Friend)
+				if (!Player)
 				{
-				   return Player->UserId == Friend->GetUserId(); 
-				});
+					continue;
+				}
+
+				const TSharedRef<FOnlineFriend>* FriendData = Store ? Store->Friends.Find(GetAccelByteId(Player->UserId)) : nullptr;
 			
 				if(FriendData != nullptr)
 				{
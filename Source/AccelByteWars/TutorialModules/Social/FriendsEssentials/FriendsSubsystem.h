@@ -104,6 +104,26 @@ protected:
 	FOnlineFriendsAccelBytePtr FriendsInterface;
 // @@@SNIPEND
 
+#pragma region "Friend List Store"
+	// Friend list of a local user indexed by AccelByte user id, kept in sync with the friends interface by applying changes as deltas.
+	struct FFriendListStore
+	{
+		FString OwnerUserId;
+		TMap<FString, TSharedRef<FOnlineFriend>> Friends;
+		TSet<FString> UserInfoResolvedIds;
+	};
+
+	FFriendListStore* FindValidFriendListStore(const int32 LocalUserNum);
+	FFriendListStore& BuildFriendListStore(const int32 LocalUserNum, const TArray<TSharedRef<FOnlineFriend>>& FriendList);
+	void ApplyFriendListDelta(const int32 LocalUserNum);
+	void ResolveFriendsUserInfo(const int32 LocalUserNum, const FOnGetCacheFriendListComplete& OnComplete);
+	TArray<TSharedRef<FOnlineFriend>> GetStoredFriendList(const int32 LocalUserNum) const;
+	FString GetLocalUserAccelByteId(const int32 LocalUserNum) const;
+	static FString GetAccelByteId(const FUniqueNetIdPtr UserId);
+
+	TMap<int32, FFriendListStore> FriendListStores;
+#pragma endregion
+
 #pragma region "CLI Cheat"
 protected:
 	virtual TArray<FCheatCommandEntry> GetCheatCommandEntries() override;
@@ -13,6 +13,14 @@ DECLARE_DELEGATE_TwoParams(FOnPresenceTaskComplete, const bool /*bWasSuccessful*
 
 #define ACCELBYTEWARS_LOCTEXT_NAMESPACE "AccelByteWars"
 
+// Presence status changes within this window are collapsed into a single update.
+#define PRESENCE_UPDATE_DEBOUNCE_DELAY 0.5f
+
+// Cached presences older than this (in seconds) are queried again.
+#define PRESENCE_CACHE_TTL 300.0
+// Maximum number of users the backend accepts in a single bulk presence query.
+#define PRESENCE_BULK_QUERY_LIMIT 100
+
 // @@@SNIPSTART PresenceEssentialsModels.h-stringmacro
 #define TEXT_PRESENCE_ONLINE NSLOCTEXT(ACCELBYTEWARS_LOCTEXT_NAMESPACE, "presence_online", "Online")
 #define TEXT_PRESENCE_OFFLINE NSLOCTEXT(ACCELBYTEWARS_LOCTEXT_NAMESPACE, "presence_offline", "Offline")
@@ -17,10 +17,10 @@
 #include "Play/OnlineSessionUtils/AccelByteWarsOnlineSessionBase.h"
 
 // @@@SNIPSTART PresenceEssentialsSubsystem.cpp-Initialize
-// @@@MULTISNIP BindPresenceActivityDelegate {"selectedLines": ["1-2", "5-64", "74-87", "89-115", "138"]}
-// @@@MULTISNIP BindPlayerListChangeDelegate {"selectedLines": ["1-2", "117-130", "138"]}
-// @@@MULTISNIP BindBulkQueryPresenceDelegate {"selectedLines": ["1-2", "132-134", "136-138"]}
-// @@@MULTISNIP BindPresenceReceivedDelegate {"selectedLines": ["1-2", "132-135", "137-138"]}
+// @@@MULTISNIP BindPresenceActivityDelegate {"selectedLines": ["1-2", "5-64", "74-87", "89-132", "155"]}
+// @@@MULTISNIP BindPlayerListChangeDelegate {"selectedLines": ["1-2", "134-147", "155"]}
+// @@@MULTISNIP BindBulkQueryPresenceDelegate {"selectedLines": ["1-2", "149-151", "153-155"]}
+// @@@MULTISNIP BindPresenceReceivedDelegate {"selectedLines": ["1-2", "149-152", "154-155"]}
 void UPresenceEssentialsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
@@ -124,6 +124,15 @@ void UPresenceEssentialsSubsystem::Initialize(FSubsystemCollectionBase& Collecti
 				UpdatePrimaryPlayerPresenceStatus();
 			});
 		}
+
+		// Update presence status once the party is resynced after connecting or reconnecting to lobby.
+		if (FOnLobbyResynced* OnLobbyResynced = OnlineSession->GetOnLobbyResyncedDelegates())
+		{
+			OnLobbyResynced->AddWeakLambda(this, [this](const int32 LocalUserNum, const bool bWasReconnected)
+			{
+				UpdatePrimaryPlayerPresenceStatus();
+			});
+		}
 	}
 
 	// Update presence status once the player logged in and connected to lobby.
@@ -132,7 +141,15 @@ void UPresenceEssentialsSubsystem::Initialize(FSubsystemCollectionBase& Collecti
 		IdentityInterface->AddOnConnectLobbyCompleteDelegate_Handle(0,
 			FOnConnectLobbyCompleteDelegate::CreateWeakLambda(this, [this](int32 LocalUserNum, bool bWasSuccessful, const FUniqueNetId& UserId, const FString& Error)
 			{
-				UpdatePrimaryPlayerPresenceStatus();
+				// A new lobby connection starts with a fresh presence, so the last acknowledged status no longer applies.
+				ResetPresencePublisher();
+
+				// If the online session resyncs the party after connecting, the status is updated once it is resynced.
+				UAccelByteWarsOnlineSessionBase* OnlineSession = GetOnlineSession();
+				if (!OnlineSession || !OnlineSession->GetOnLobbyResyncedDelegates())
+				{
+					UpdatePrimaryPlayerPresenceStatus();
+				}
 			}
 		));
 	}
@@ -162,10 +179,10 @@ void UPresenceEssentialsSubsystem::Initialize(FSubsystemCollectionBase& Collecti
 // @@@SNIPEND
 
 // @@@SNIPSTART PresenceEssentialsSubsystem.cpp-Deinitialize
-// @@@MULTISNIP UnbindPresenceActivityDelegate {"selectedLines": ["1-2", "5-44", "51-58", "60-75", "96"]}
-// @@@MULTISNIP UnbindPlayerListChangeDelegate {"selectedLines": ["1-2", "77-89", "96"]}
-// @@@MULTISNIP UnbindBulkQueryPresenceDelegate {"selectedLines": ["1-2", "91-92", "94-96"]}
-// @@@MULTISNIP UnbindPresenceReceivedDelegate {"selectedLines": ["1-2", "91-93", "95-96"]}
+// @@@MULTISNIP UnbindPresenceActivityDelegate {"selectedLines": ["1-2", "5-50", "57-64", "66-86", "107"]}
+// @@@MULTISNIP UnbindPlayerListChangeDelegate {"selectedLines": ["1-2", "88-100", "107"]}
+// @@@MULTISNIP UnbindBulkQueryPresenceDelegate {"selectedLines": ["1-2", "102-103", "105-107"]}
+// @@@MULTISNIP UnbindPresenceReceivedDelegate {"selectedLines": ["1-2", "102-104", "106-107"]}
 void UPresenceEssentialsSubsystem::Deinitialize()
 {
 	Super::Deinitialize();
@@ -173,6 +190,12 @@ void UPresenceEssentialsSubsystem::Deinitialize()
 	// Clean-up cache.
 	LevelStatus = FString();
 	ActivityStatus = FString();
+	ResetPresencePublisher();
+	KnownFriendIds.Empty();
+	PresenceCacheTimes.Empty();
+	BulkQueryPresenceRequests.Empty();
+	PendingBulkQueryPresenceChunks.Empty();
+	InFlightBulkQueryPresenceChunk.Reset();
 
 	// Unbind events.
 	AAccelByteWarsGameState::OnInitialized.RemoveAll(this);
@@ -235,6 +258,11 @@ void UPresenceEssentialsSubsystem::Deinitialize()
 		{
 			OnLeaveSessionComplete->RemoveAll(this);
 		}
+
+		if (FOnLobbyResynced* OnLobbyResynced = OnlineSession->GetOnLobbyResyncedDelegates())
+		{
+			OnLobbyResynced->RemoveAll(this);
+		}
 	}
 
 	if (FOnlineIdentityAccelBytePtr IdentityInterface = GetIdentityInterface())
@@ -307,11 +335,87 @@ void UPresenceEssentialsSubsystem::UpdatePrimaryPlayerPresenceStatus()
 		PresenceStatus += (ActivityStatus.IsEmpty() ? FString(" - ") : FString(", ")) + PartyStatus;
 	}
 
-	// Set presence status.
-	SetPresenceStatus(UserId, PresenceStatus);
+	// Skip the update if the backend already has this status. Otherwise, collapse bursts of changes into one update.
+	PendingPresenceStatus = PresenceStatus;
+	if (!bIsPublishingPresenceStatus && AcknowledgedPresenceStatus.IsSet() && AcknowledgedPresenceStatus.GetValue().Equals(PendingPresenceStatus, ESearchCase::CaseSensitive))
+	{
+		GetGameInstance()->GetTimerManager().ClearTimer(PublishPresenceStatusTimerHandle);
+		UE_LOG_PRESENCEESSENTIALS(Log, TEXT("Presence status is unchanged, skip updating presence."));
+		return;
+	}
+
+	GetGameInstance()->GetTimerManager().SetTimer(PublishPresenceStatusTimerHandle, this, &ThisClass::PublishPendingPresenceStatus, PRESENCE_UPDATE_DEBOUNCE_DELAY, false);
 }
 // @@@SNIPEND
 
+#pragma region "Presence Publisher"
+void UPresenceEssentialsSubsystem::PublishPendingPresenceStatus()
+{
+	// The in-flight update will publish the latest pending status once it completes.
+	if (bIsPublishingPresenceStatus)
+	{
+		return;
+	}
+
+	if (AcknowledgedPresenceStatus.IsSet() && AcknowledgedPresenceStatus.GetValue().Equals(PendingPresenceStatus, ESearchCase::CaseSensitive))
+	{
+		return;
+	}
+
+	const FUniqueNetIdPtr UserId = GetPrimaryPlayerUserId();
+	if (!UserId)
+	{
+		UE_LOG_PRESENCEESSENTIALS(Warning, TEXT("Unable to publish presence status. User Id is invalid."));
+		return;
+	}
+
+	bIsPublishingPresenceStatus = true;
+	SetPresenceStatus(UserId, PendingPresenceStatus, FOnPresenceTaskComplete::CreateUObject(this, &ThisClass::OnPublishPresenceStatusComplete, PendingPresenceStatus, PresencePublisherGeneration));
+}
+
+void UPresenceEssentialsSubsystem::OnPublishPresenceStatusComplete(const bool bWasSuccessful, const TSharedPtr<FOnlineUserPresenceAccelByte> Presence, const FString PublishedStatus, const int32 PublisherGeneration)
+{
+	bIsPublishingPresenceStatus = false;
+
+	// The publisher was reset while this update was in flight. Its result no longer applies, publish what was requested since then.
+	if (PublisherGeneration != PresencePublisherGeneration)
+	{
+		if (!PendingPresenceStatus.IsEmpty())
+		{
+			PublishPendingPresenceStatus();
+		}
+		return;
+	}
+
+	if (bWasSuccessful)
+	{
+		AcknowledgedPresenceStatus = PublishedStatus;
+	}
+	else
+	{
+		AcknowledgedPresenceStatus.Reset();
+	}
+
+	// The status changed while the update was in flight, publish the latest one.
+	if (!PendingPresenceStatus.Equals(PublishedStatus, ESearchCase::CaseSensitive))
+	{
+		PublishPendingPresenceStatus();
+	}
+}
+
+void UPresenceEssentialsSubsystem::ResetPresencePublisher()
+{
+	if (GetGameInstance())
+	{
+		GetGameInstance()->GetTimerManager().ClearTimer(PublishPresenceStatusTimerHandle);
+	}
+
+	PendingPresenceStatus = FString();
+	AcknowledgedPresenceStatus.Reset();
+	PresencePublisherGeneration++;
+}
+#pragma endregion
+
 // @@@SNIPSTART PresenceEssentialsSubsystem.cpp-OnLevelLoaded
 void UPresenceEssentialsSubsystem::OnLevelLoaded()
 {
@@ -397,19 +501,47 @@ void UPresenceEssentialsSubsystem::OnFriendListChange()
 	}
 	if (OutFriendList.IsEmpty())
 	{
+		KnownFriendIds.Empty();
 		UE_LOG_PRESENCEESSENTIALS(Warning, TEXT("Unable to query friends' presences. No friends found."));
 		return;
 	}
 
-	// Collect their user IDs.
+	// Collect the user IDs of the friends whose presences are not known yet. The other friends' presences are kept up to date by presence events.
 	TArray<FUniqueNetIdRef> FriendIds;
+	TSet<FString> CurrentFriendIds;
+	CurrentFriendIds.Reserve(OutFriendList.Num());
 	for (const TSharedRef<FOnlineFriend>& Friend : OutFriendList)
 	{
-		FriendIds.Add(Friend->GetUserId());
+		const FUniqueNetIdAccelByteUserRef FriendABId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(Friend->GetUserId());
+		const FString FriendId = FriendABId->GetAccelByteId();
+		CurrentFriendIds.Add(FriendId);
+		if (KnownFriendIds.Contains(FriendId))
+		{
+			continue;
+		}
+
+		// A fresh cached presence is already known, the others become known once their query succeeds.
+		if (GetFreshCachedPresence(FriendABId.Get()))
+		{
+			KnownFriendIds.Add(FriendId);
+		}
+		else
+		{
+			FriendIds.Add(Friend->GetUserId());
+		}
+	}
+
+	// Forget the removed friends, so their presences are queried again if they are added back.
+	KnownFriendIds = KnownFriendIds.Intersect(CurrentFriendIds);
+
+	if (FriendIds.IsEmpty())
+	{
+		UE_LOG_PRESENCEESSENTIALS(Log, TEXT("No new friends found, skip querying friends' presences."));
+		return;
 	}
 
 	// Query friends' presences.
-	UE_LOG_PRESENCEESSENTIALS(Log, TEXT("Querying friends' presences."));
+	UE_LOG_PRESENCEESSENTIALS(Log, TEXT("Querying presences of %d new friend(s)."), FriendIds.Num());
 	BulkQueryPresence(UserId, FriendIds);
 }
 // @@@SNIPEND
@@ -498,9 +630,7 @@ void UPresenceEssentialsSubsystem::GetPresence(const FUniqueNetIdPtr UserId, boo
 	if(!bForceQuery)
 	{
 		// Try get the presence from cache.
-		TSharedPtr<FOnlineUserPresence> OutPresence = nullptr;
-		PresenceInterface->GetCachedPresence(UserABId.ToSharedRef().Get(), OutPresence);
-		if (TSharedPtr<FOnlineUserPresenceAccelByte> ABPresence = StaticCastSharedPtr<FOnlineUserPresenceAccelByte>(OutPresence))
+		if (TSharedPtr<FOnlineUserPresenceAccelByte> ABPresence = GetFreshCachedPresence(UserABId.ToSharedRef().Get()))
 		{
 			UE_LOG_PRESENCEESSENTIALS(Log, TEXT("Success to get presence for user: %s"), *UserABId->GetAccelByteId());
 			OnComplete.ExecuteIfBound(true, ABPresence);
@@ -553,6 +683,7 @@ void UPresenceEssentialsSubsystem::OnGetPresenceComplete(const FUniqueNetId& Use
 	}
 
 	UE_LOG_PRESENCEESSENTIALS(Log, TEXT("Success to get presence for user: %s"), *UserABId->GetAccelByteId());
+	PresenceCacheTimes.Add(UserABId->GetAccelByteId(), FPlatformTime::Seconds());
 
 	OnComplete.ExecuteIfBound(true, ABPresence);
 }
@@ -567,48 +698,59 @@ void UPresenceEssentialsSubsystem::BulkQueryPresence(const FUniqueNetIdPtr UserI
 	if (!PresenceInterface)
 	{
 		UE_LOG_PRESENCEESSENTIALS(Warning, TEXT("Cannot bulk query presence. Presence interface is invalid."));
-		OnBulkQueryPresenceComplete(false, CachedPresences);
+		OnBulkQueryPresenceCompleteDelegates.Broadcast(false, CachedPresences);
 		return;
 	}
 
 	if (!UserId || UserIds.IsEmpty())
 	{
 		UE_LOG_PRESENCEESSENTIALS(Warning, TEXT("Cannot bulk query presence. User Ids are invalid."));
-		OnBulkQueryPresenceComplete(false, CachedPresences);
+		OnBulkQueryPresenceCompleteDelegates.Broadcast(false, CachedPresences);
 		return;
 	}
 
-	// Try to collect cached presences.
+	// Serve the fresh cached presences and collect the rest to be queried.
+	TArray<FUniqueNetIdRef> MissingUserIds;
 	for (const FUniqueNetIdRef& TargetUserId : UserIds)
 	{
 		const FUniqueNetIdAccelByteUserRef TargetUserABId = StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(TargetUserId);
 		if (!TargetUserABId->IsValid())
 		{
-			return;
+			UE_LOG_PRESENCEESSENTIALS(Warning, TEXT("Skipping bulk query presence for an invalid User Id."));
+			continue;
 		}
 
-		TSharedPtr<FOnlineUserPresence> OutPresence;
-		PresenceInterface->GetCachedPresence(TargetUserABId.Get(), OutPresence);
-		
-		if (const TSharedPtr<FOnlineUserPresenceAccelByte> ABPresence = StaticCastSharedPtr<FOnlineUserPresenceAccelByte>(OutPresence))
+		if (const TSharedPtr<FOnlineUserPresenceAccelByte> ABPresence = GetFreshCachedPresence(TargetUserABId.Get()))
 		{
 			CachedPresences.Add(TargetUserABId->GetAccelByteId(), ABPresence.ToSharedRef());
 		}
 		else
 		{
-			break;
+			MissingUserIds.Add(TargetUserId);
 		}
 	}
 
 	// The cached presences are complete, return the cached presence.
-	if (CachedPresences.Num() == UserIds.Num())
+	if (MissingUserIds.IsEmpty())
 	{
-		OnBulkQueryPresenceComplete(true, CachedPresences);
+		UE_LOG_PRESENCEESSENTIALS(Log, TEXT("Success to bulk query presences from cache. Presences found: %d"), CachedPresences.Num());
+		OnBulkQueryPresenceCompleteDelegates.Broadcast(true, CachedPresences);
 		return;
 	}
 
-	// There are some missing cached presences, try to query.
-	PresenceInterface->BulkQueryPresence(UserId.ToSharedRef().Get(), UserIds);
+	// Query only the missing presences, split by the backend limit. The request completes once all of its chunks are complete.
+	const int32 RequestId = ++LastBulkQueryPresenceRequestId;
+	FBulkQueryPresenceRequest& Request = BulkQueryPresenceRequests.Add(RequestId);
+	Request.Presences = MoveTemp(CachedPresences);
+	for (int32 Index = 0; Index < MissingUserIds.Num(); Index += PRESENCE_BULK_QUERY_LIMIT)
+	{
+		const int32 ChunkSize = FMath::Min(PRESENCE_BULK_QUERY_LIMIT, MissingUserIds.Num() - Index);
+		PendingBulkQueryPresenceChunks.Add(FBulkQueryPresenceChunk{ RequestId, UserId.ToSharedRef(), TArray<FUniqueNetIdRef>(MissingUserIds.GetData() + Index, ChunkSize) });
+		Request.RemainingChunks++;
+	}
+
+	UE_LOG_PRESENCEESSENTIALS(Log, TEXT("Bulk query presences. Cached: %d, to query: %d"), Request.Presences.Num(), MissingUserIds.Num());
+	QueryNextBulkPresenceChunk();
 }
 // @@@SNIPEND
 
@@ -617,10 +759,107 @@ void UPresenceEssentialsSubsystem::OnBulkQueryPresenceComplete(const bool bWasSu
 {
 	UE_LOG_PRESENCEESSENTIALS(Log, TEXT("%s to bulk query presences. Presences found: %d"), bWasSuccessful ? TEXT("Success") : TEXT("Failed"), Presences.Num());
 
-	OnBulkQueryPresenceCompleteDelegates.Broadcast(bWasSuccessful, Presences);
+	const double CurrentTime = FPlatformTime::Seconds();
+	for (const TPair<FString, TSharedRef<FOnlineUserPresenceAccelByte>>& Presence : Presences)
+	{
+		PresenceCacheTimes.Add(Presence.Key, CurrentTime);
+	}
+
+	// The query was not sent by this subsystem, pass the result as is.
+	if (!InFlightBulkQueryPresenceChunk.IsSet())
+	{
+		OnBulkQueryPresenceCompleteDelegates.Broadcast(bWasSuccessful, Presences);
+		return;
+	}
+
+	const FBulkQueryPresenceChunk CompletedChunk = InFlightBulkQueryPresenceChunk.GetValue();
+	InFlightBulkQueryPresenceChunk.Reset();
+
+	CompleteBulkQueryPresenceChunk(CompletedChunk, bWasSuccessful, Presences);
+	QueryNextBulkPresenceChunk();
 }
 // @@@SNIPEND
 
+TSharedPtr<FOnlineUserPresenceAccelByte> UPresenceEssentialsSubsystem::GetFreshCachedPresence(const FUniqueNetIdAccelByteUser& UserId) const
+{
+	const double* CachedTime = PresenceCacheTimes.Find(UserId.GetAccelByteId());
+	if (!CachedTime || FPlatformTime::Seconds() - *CachedTime > PRESENCE_CACHE_TTL)
+	{
+		return nullptr;
+	}
+
+	FOnlinePresenceAccelBytePtr PresenceInterface = GetPresenceInterface();
+	if (!PresenceInterface)
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FOnlineUserPresence> OutPresence;
+	PresenceInterface->GetCachedPresence(UserId, OutPresence);
+	return StaticCastSharedPtr<FOnlineUserPresenceAccelByte>(OutPresence);
+}
+
+void UPresenceEssentialsSubsystem::QueryNextBulkPresenceChunk()
+{
+	// Chunks are sent one at a time, so each bulk query result can be matched with its request.
+	if (InFlightBulkQueryPresenceChunk.IsSet() || PendingBulkQueryPresenceChunks.IsEmpty())
+	{
+		return;
+	}
+
+	FOnlinePresenceAccelBytePtr PresenceInterface = GetPresenceInterface();
+	if (!PresenceInterface)
+	{
+		// None of the chunks can be sent, fail them so their requests still complete.
+		UE_LOG_PRESENCEESSENTIALS(Warning, TEXT("Cannot bulk query presence. Presence interface is invalid."));
+		const TArray<FBulkQueryPresenceChunk> FailedChunks = MoveTemp(PendingBulkQueryPresenceChunks);
+		PendingBulkQueryPresenceChunks.Reset();
+		for (const FBulkQueryPresenceChunk& FailedChunk : FailedChunks)
+		{
+			CompleteBulkQueryPresenceChunk(FailedChunk, false, FUserIDPresenceMap());
+		}
+		return;
+	}
+
+	InFlightBulkQueryPresenceChunk = PendingBulkQueryPresenceChunks[0];
+	PendingBulkQueryPresenceChunks.RemoveAt(0);
+	PresenceInterface->BulkQueryPresence(InFlightBulkQueryPresenceChunk->UserId.Get(), InFlightBulkQueryPresenceChunk->UserIds);
+}
+
+void UPresenceEssentialsSubsystem::CompleteBulkQueryPresenceChunk(const FBulkQueryPresenceChunk& Chunk, const bool bWasSuccessful, const FUserIDPresenceMap& Presences)
+{
+	// Only friends whose presences were queried successfully become known, the others are queried again on the next friend list change.
+	FOnlineFriendsAccelBytePtr FriendsInterface = GetFriendsInterface();
+	if (bWasSuccessful && FriendsInterface)
+	{
+		for (const FUniqueNetIdRef& QueriedUserId : Chunk.UserIds)
+		{
+			if (FriendsInterface->IsFriend(0, QueriedUserId.Get(), TEXT("")))
+			{
+				KnownFriendIds.Add(StaticCastSharedRef<const FUniqueNetIdAccelByteUser>(QueriedUserId)->GetAccelByteId());
+			}
+		}
+	}
+
+	// Merge the chunk result and complete the request once all of its chunks are complete.
+	FBulkQueryPresenceRequest* Request = BulkQueryPresenceRequests.Find(Chunk.RequestId);
+	if (!Request)
+	{
+		return;
+	}
+
+	Request->Presences.Append(Presences);
+	Request->bWasSuccessful &= bWasSuccessful;
+	Request->RemainingChunks--;
+
+	if (Request->RemainingChunks <= 0)
+	{
+		const FBulkQueryPresenceRequest CompletedRequest = MoveTemp(*Request);
+		BulkQueryPresenceRequests.Remove(Chunk.RequestId);
+		OnBulkQueryPresenceCompleteDelegates.Broadcast(CompletedRequest.bWasSuccessful, CompletedRequest.Presences);
+	}
+}
+
 // @@@SNIPSTART PresenceEssentialsSubsystem.cpp-SetPresenceStatus
 void UPresenceEssentialsSubsystem::SetPresenceStatus(const FUniqueNetIdPtr UserId, const FString& Status, const FOnPresenceTaskComplete& OnComplete)
 {
@@ -697,6 +936,7 @@ void UPresenceEssentialsSubsystem::OnPresenceReceived(const FUniqueNetId& UserId
 	}
 
 	UE_LOG_PRESENCEESSENTIALS(Log, TEXT("Received presence update for user: %s"), *UserABId->GetAccelByteId());
+	PresenceCacheTimes.Add(UserABId->GetAccelByteId(), FPlatformTime::Seconds());
 
 	OnPresenceReceivedDelegates.Broadcast(UserABId.Get(), Presence);
 }
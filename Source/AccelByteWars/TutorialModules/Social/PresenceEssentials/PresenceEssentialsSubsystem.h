@@ -97,4 +97,54 @@ private:
 	FOnPresenceReceived OnPresenceReceivedDelegates;
 	FOnBulkQueryPresenceComplete OnBulkQueryPresenceCompleteDelegates;
 // @@@SNIPEND
+
+#pragma region "Bulk Presence Resolver"
+	struct FBulkQueryPresenceChunk
+	{
+		int32 RequestId;
+		FUniqueNetIdRef UserId;
+		TArray<FUniqueNetIdRef> UserIds;
+	};
+
+	struct FBulkQueryPresenceRequest
+	{
+		FUserIDPresenceMap Presences;
+		int32 RemainingChunks = 0;
+		bool bWasSuccessful = true;
+	};
+
+	TSharedPtr<FOnlineUserPresenceAccelByte> GetFreshCachedPresence(const FUniqueNetIdAccelByteUser& UserId) const;
+	void QueryNextBulkPresenceChunk();
+	void CompleteBulkQueryPresenceChunk(const FBulkQueryPresenceChunk& Chunk, const bool bWasSuccessful, const FUserIDPresenceMap& Presences);
+
+	// Time (FPlatformTime::Seconds) each user's presence was last received, used to expire cached presences.
+	TMap<FString, double> PresenceCacheTimes;
+
+	TMap<int32, FBulkQueryPresenceRequest> BulkQueryPresenceRequests;
+	TArray<FBulkQueryPresenceChunk> PendingBulkQueryPresenceChunks;
+	TOptional<FBulkQueryPresenceChunk> InFlightBulkQueryPresenceChunk;
+	int32 LastBulkQueryPresenceRequestId = 0;
+#pragma endregion
+
+#pragma region "Presence Publisher"
+	void PublishPendingPresenceStatus();
+	void OnPublishPresenceStatusComplete(const bool bWasSuccessful, const TSharedPtr<FOnlineUserPresenceAccelByte> Presence, const FString PublishedStatus, const int32 PublisherGeneration);
+	void ResetPresencePublisher();
+
+	// Latest presence status requested by the game, waiting to be published.
+	FString PendingPresenceStatus;
+
+	// Last presence status the backend acknowledged for the primary player, unset if unknown.
+	TOptional<FString> AcknowledgedPresenceStatus;
+
+	// Stays set until the in-flight update completes, even across resets, so only one update is ever in flight.
+	bool bIsPublishingPresenceStatus = false;
+
+	// Incremented on reset. Completions of updates sent before the last reset are stale and never acknowledged.
+	int32 PresencePublisherGeneration = 0;
+	FTimerHandle PublishPresenceStatusTimerHandle;
+
+	// Friends whose presences were queried successfully, used to only query the friends whose presences are not known yet.
+	TSet<FString> KnownFriendIds;
+#pragma endregion
 };
@@ -226,6 +226,10 @@ bool UPrivateChatSubsystem::GetLastPrivateChatMessages(const FUniqueNetIdPtr Use
 	GetChatInterface()->GetLastMessages(UserId.ToSharedRef().Get(), RoomId, NumMessages, OutMessages);
 	UE_LOG_PRIVATECHAT(Log, TEXT("Success to get last chat messages. Number of returned messages: %d"), OutMessages.Num());
 
+	// Store the messages, so the ones received later can be displayed incrementally.
+	ChatMessageStore.AddMessages(RoomId, OutMessages);
+	LastNotifiedChatSequences.FindOrAdd(RoomId) = ChatMessageStore.GetLastSequence(RoomId);
+
 	return true;
 }
 // @@@SNIPEND
@@ -260,6 +264,12 @@ void UPrivateChatSubsystem::OnPrivateChatMessageReceived(const FUniqueNetId& Use
 		!Message.Get().GetNickname().IsEmpty() ? *Message.Get().GetNickname() : *UTutorialModuleOnlineUtility::GetUserDefaultDisplayName(Message->GetUserId().Get()),
 		*Message.Get().GetBody());
 
+	const FString RoomId = GetPrivateChatRoomId(UserId.AsShared(), Message->GetUserId());
+	if (!RoomId.IsEmpty())
+	{
+		ChatMessageStore.AddMessage(RoomId, Message);
+	}
+
 	OnPrivateChatMessageReceivedDelegates.Broadcast(UserId, Message);
 }
 // @@@SNIPEND
@@ -280,6 +290,11 @@ void UPrivateChatSubsystem::PushPrivateChatMessageReceivedNotification(const FUn
 		return;
 	}
 
+	if (!ShouldNotifyPrivateChatMessage(UserId, Message))
+	{
+		return;
+	}
+
 	// Only push a notification only if the player is not in the chat menu of the same recipient.
 	const UCommonActivatableWidget* ActiveWidget = UAccelByteWarsBaseUI::GetActiveWidgetOfStack(EBaseUIStackType::Menu, this);
 	if (const UPrivateChatWidget* PrivateChatWidget = Cast<UPrivateChatWidget>(ActiveWidget))
@@ -377,3 +392,36 @@ UPromptSubsystem* UPrivateChatSubsystem::GetPromptSubsystem() const
 	return GameInstance->GetSubsystem<UPromptSubsystem>();
 }
 // @@@SNIPEND
+
+#pragma region "Chat Message Store"
+int64 UPrivateChatSubsystem::GetPrivateChatMessagesSince(const FChatRoomId& RoomId, const int64 AfterSequence, TArray<TSharedRef<FChatMessage>>& OutMessages) const
+{
+	return ChatMessageStore.GetMessagesSince(RoomId, AfterSequence, OutMessages);
+}
+
+int64 UPrivateChatSubsystem::GetLastPrivateChatMessageSequence(const FChatRoomId& RoomId) const
+{
+	return ChatMessageStore.GetLastSequence(RoomId);
+}
+
+bool UPrivateChatSubsystem::ShouldNotifyPrivateChatMessage(const FUniqueNetId& UserId, const TSharedRef<FChatMessage>& Message)
+{
+	const FString RoomId = GetPrivateChatRoomId(UserId.AsShared(), Message->GetUserId());
+	if (RoomId.IsEmpty())
+	{
+		return true;
+	}
+
+	// A message keeps its sequence number when it is received again, so it is only notified once.
+	const int64 Sequence = ChatMessageStore.AddMessage(RoomId, Message);
+	int64& LastNotifiedSequence = LastNotifiedChatSequences.FindOrAdd(RoomId);
+	if (Sequence == INDEX_NONE || Sequence <= LastNotifiedSequence)
+	{
+		UE_LOG_PRIVATECHAT(Verbose, TEXT("Skip private chat message notification on Room %s. The message was already notified."), *RoomId);
+		return false;
+	}
+
+	LastNotifiedSequence = Sequence;
+	return true;
+}
+#pragma endregion
@@ -9,6 +9,7 @@
 #include "OnlineChatInterfaceAccelByte.h"
 #include "OnlineIdentityInterfaceAccelByte.h"
 #include "PrivateChatLog.h"
+#include "Social/ChatEssentials/ChatMessageStore.h"
 #include "Core/AssetManager/TutorialModules/TutorialModuleSubsystem.h"
 #include "PrivateChatSubsystem.generated.h"
 
@@ -80,4 +81,21 @@ private:
 	int32 ReconnectChatNumTries = 0;
 	const int32 ReconnectChatMaxTries = 3;
 // @@@SNIPEND
+
+#pragma region "Chat Message Store"
+public:
+	/**
+	 * @brief Get the stored messages of a private chat room newer than AfterSequence, ordered from the oldest.
+	 * @return The sequence number of the newest stored message of the private chat room.
+	 */
+	int64 GetPrivateChatMessagesSince(const FChatRoomId& RoomId, const int64 AfterSequence, TArray<TSharedRef<FChatMessage>>& OutMessages) const;
+	int64 GetLastPrivateChatMessageSequence(const FChatRoomId& RoomId) const;
+
+private:
+	/** Returns false if the message was already notified, e.g. when it is replayed after reconnecting to chat. */
+	bool ShouldNotifyPrivateChatMessage(const FUniqueNetId& UserId, const TSharedRef<FChatMessage>& Message);
+
+	FChatMessageStore ChatMessageStore;
+	TMap<FChatRoomId, int64> LastNotifiedChatSequences;
+#pragma endregion
 };
@@ -181,14 +181,14 @@ void UPrivateChatWidget::OnSendPrivateChatComplete(FString UserId, FString MsgBo
 // @@@SNIPSTART PrivateChatWidget.cpp-OnPrivateChatMessageReceived
 void UPrivateChatWidget::OnPrivateChatMessageReceived(const FUniqueNetId& UserId, const TSharedRef<FChatMessage>& Message)
 {
-	// Show the received chat message.
-	AppendChatMessage(Message.Get());
+	// Show the received chat message along with any other message not displayed yet.
+	AppendNewChatMessages();
 }
 // @@@SNIPEND
 
 // @@@SNIPSTART PrivateChatWidget.cpp-GetLastPrivateChatMessages
-// @@@MULTISNIP AddingUI {"selectedLines": ["1-2" ,"9-20", "61"]}
-void UPrivateChatWidget::GetLastPrivateChatMessages() const
+// @@@MULTISNIP AddingUI {"selectedLines": ["1-2" ,"9-20", "65"]}
+void UPrivateChatWidget::GetLastPrivateChatMessages()
 {
 	if (!PrivateChatSubsystem)
 	{
@@ -229,6 +229,10 @@ void UPrivateChatWidget::GetLastPrivateChatMessages() const
 		W_Chat->GetMaxChatHistory(),
 		OutMessages))
 	{
+		// Remember the latest stored message, so only newer messages are appended when they are received.
+		DisplayedChatRoomId = ChatRoomId;
+		LastDisplayedChatSequence = PrivateChatSubsystem->GetLastPrivateChatMessageSequence(ChatRoomId);
+
 		// Abort if last messages is empty.
 		if (OutMessages.IsEmpty())
 		{
@@ -250,3 +254,51 @@ void UPrivateChatWidget::GetLastPrivateChatMessages() const
 	}
 }
 // @@@SNIPEND
+
+#pragma region "Incremental Chat Display"
+void UPrivateChatWidget::AppendNewChatMessages()
+{
+	if (!PrivateChatSubsystem)
+	{
+		UE_LOG_PRIVATECHAT(Warning, TEXT("Cannot append new private chat messages. Private Chat subsystem is not valid."));
+		return;
+	}
+
+	if (!ensure(GetOwningPlayer()))
+	{
+		UE_LOG_PRIVATECHAT(Warning, TEXT("Cannot append new private chat messages. PlayerController is not valid."));
+		return;
+	}
+
+	const ULocalPlayer* LocalPlayer = GetOwningPlayer()->GetLocalPlayer();
+	if (!ensure(LocalPlayer))
+	{
+		UE_LOG_PRIVATECHAT(Warning, TEXT("Cannot append new private chat messages. LocalPlayer is not valid."));
+		return;
+	}
+
+	// Messages from other users are stored in their own private chat rooms, so they are not appended here.
+	const FString ChatRoomId = PrivateChatSubsystem->GetPrivateChatRoomId(
+		LocalPlayer->GetPreferredUniqueNetId().GetUniqueNetId(),
+		PrivateChatRecipientUserId);
+	if (ChatRoomId.IsEmpty())
+	{
+		return;
+	}
+
+	// The private chat room was created after the messages were displayed, display it from the start.
+	if (!DisplayedChatRoomId.Equals(ChatRoomId))
+	{
+		W_Chat->ClearChatMessages();
+		GetLastPrivateChatMessages();
+		return;
+	}
+
+	TArray<TSharedRef<FChatMessage>> NewMessages;
+	LastDisplayedChatSequence = PrivateChatSubsystem->GetPrivateChatMessagesSince(ChatRoomId, LastDisplayedChatSequence, NewMessages);
+	for (const TSharedRef<FChatMessage>& Message : NewMessages)
+	{
+		AppendChatMessage(Message.Get());
+	}
+}
+#pragma endregion
@@ -39,7 +39,7 @@ protected:
 
 	void OnPrivateChatMessageReceived(const FUniqueNetId& UserId, const TSharedRef<FChatMessage>& Message);
 
-	void GetLastPrivateChatMessages() const;
+	void GetLastPrivateChatMessages();
 
 	UPROPERTY()
 	UPrivateChatSubsystem* PrivateChatSubsystem;
@@ -55,4 +55,12 @@ protected:
 	UPROPERTY(BlueprintReadOnly, meta = (BindWidgetOptional, BlueprintProtected = true, AllowPrivateAccess = true))
 	UCommonButtonBase* Btn_Back;
 // @@@SNIPEND
+
+#pragma region "Incremental Chat Display"
+	/** Append the messages of the private chat room with the current recipient that are not displayed yet. */
+	void AppendNewChatMessages();
+
+	FString DisplayedChatRoomId;
+	int64 LastDisplayedChatSequence = 0;
+#pragma endregion
 };
@@ -220,6 +220,10 @@ bool USessionChatSubsystem::GetLastChatMessages(const FUniqueNetIdPtr UserId, co
 	GetChatInterface()->GetLastMessages(UserId.ToSharedRef().Get(), RoomId, NumMessages, OutMessages);
 	UE_LOG_SESSIONCHAT(Log, TEXT("Success to get last chat messages. Returned messages: %d"), OutMessages.Num());
 
+	// Store the messages, so the ones received later can be displayed incrementally.
+	ChatMessageStore.AddMessages(RoomId, OutMessages);
+	LastNotifiedChatSequences.FindOrAdd(RoomId) = ChatMessageStore.GetLastSequence(RoomId);
+
 	return true;
 }
 // @@@SNIPEND
@@ -282,6 +286,7 @@ void USessionChatSubsystem::OnChatRoomMessageReceived(const FUniqueNetId& UserId
 		*RoomId,
 		*Message.Get().GetBody());
 
+	ChatMessageStore.AddMessage(RoomId, Message);
 	OnChatRoomMessageReceivedDelegates.Broadcast(UserId, RoomId, Message);
 }
 // @@@SNIPEND
@@ -295,6 +300,11 @@ void USessionChatSubsystem::PushChatRoomMessageReceivedNotification(const FUniqu
 		return;
 	}
 
+	if (!ShouldNotifyChatMessage(RoomId, Message))
+	{
+		return;
+	}
+
 	if (!GetPromptSubsystem())
 	{
 		UE_LOG_SESSIONCHAT(Warning, TEXT("Cannot push chat room message received notification. Prompt Subsystem is not valid."));
@@ -441,3 +451,30 @@ UPromptSubsystem* USessionChatSubsystem::GetPromptSubsystem() const
 	return GameInstance->GetSubsystem<UPromptSubsystem>();
 }
 // @@@SNIPEND
+
+#pragma region "Chat Message Store"
+int64 USessionChatSubsystem::GetChatMessagesSince(const FChatRoomId& RoomId, const int64 AfterSequence, TArray<TSharedRef<FChatMessage>>& OutMessages) const
+{
+	return ChatMessageStore.GetMessagesSince(RoomId, AfterSequence, OutMessages);
+}
+
+int64 USessionChatSubsystem::GetLastChatMessageSequence(const FChatRoomId& RoomId) const
+{
+	return ChatMessageStore.GetLastSequence(RoomId);
+}
+
+bool USessionChatSubsystem::ShouldNotifyChatMessage(const FChatRoomId& RoomId, const TSharedRef<FChatMessage>& Message)
+{
+	// A message keeps its sequence number when it is received again, so it is only notified once.
+	const int64 Sequence = ChatMessageStore.AddMessage(RoomId, Message);
+	int64& LastNotifiedSequence = LastNotifiedChatSequences.FindOrAdd(RoomId);
+	if (Sequence == INDEX_NONE || Sequence <= LastNotifiedSequence)
+	{
+		UE_LOG_SESSIONCHAT(Verbose, TEXT("Skip chat message notification on Room %s. The message was already notified."), *RoomId);
+		return false;
+	}
+
+	LastNotifiedSequence = Sequence;
+	return true;
+}
+#pragma endregion
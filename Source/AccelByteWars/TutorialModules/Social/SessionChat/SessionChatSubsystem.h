@@ -10,6 +10,7 @@
 #include "OnlineSessionInterfaceV2AccelByte.h"
 #include "OnlineIdentityInterfaceAccelByte.h"
 #include "SessionChatLog.h"
+#include "Social/ChatEssentials/ChatMessageStore.h"
 #include "Core/AssetManager/TutorialModules/TutorialModuleSubsystem.h"
 #include "SessionChatSubsystem.generated.h"
 
@@ -86,4 +87,21 @@ private:
 	int32 ReconnectChatNumTries = 0;
 	const int32 ReconnectChatMaxTries = 3;
 // @@@SNIPEND
+
+#pragma region "Chat Message Store"
+public:
+	/**
+	 * @brief Get the stored messages of a chat room newer than AfterSequence, ordered from the oldest.
+	 * @return The sequence number of the newest stored message of the chat room.
+	 */
+	int64 GetChatMessagesSince(const FChatRoomId& RoomId, const int64 AfterSequence, TArray<TSharedRef<FChatMessage>>& OutMessages) const;
+	int64 GetLastChatMessageSequence(const FChatRoomId& RoomId) const;
+
+private:
+	/** Returns false if the message was already notified, e.g. when it is replayed after reconnecting to chat. */
+	bool ShouldNotifyChatMessage(const FChatRoomId& RoomId, const TSharedRef<FChatMessage>& Message);
+
+	FChatMessageStore ChatMessageStore;
+	TMap<FChatRoomId, int64> LastNotifiedChatSequences;
+#pragma endregion
 };
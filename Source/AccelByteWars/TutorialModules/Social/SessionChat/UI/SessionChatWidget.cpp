@@ -209,7 +209,7 @@ void USessionChatWidget::SendChatMessage(const FText& MessageText)
 // @@@SNIPEND
 
 // @@@SNIPSTART SessionChatWidget.cpp-GetLastChatMessages
-// @@@MULTISNIP AddingUI {"selectedLines": ["1-2", "9-26", "77"]}
+// @@@MULTISNIP AddingUI {"selectedLines": ["1-2", "9-26", "81"]}
 void USessionChatWidget::GetLastChatMessages()
 {
 	if (!SessionChatSubsystem) 
@@ -266,6 +266,10 @@ void USessionChatWidget::GetLastChatMessages()
 		W_ActiveChat->GetMaxChatHistory(),
 		OutMessages)) 
 	{
+		// Remember the latest stored message, so only newer messages are appended when they are received.
+		DisplayedChatRoomId = ChatRoomId;
+		LastDisplayedChatSequence = SessionChatSubsystem->GetLastChatMessageSequence(ChatRoomId);
+
 		// Abort if last messages is empty.
 		if (OutMessages.IsEmpty())
 		{
@@ -339,7 +343,39 @@ void USessionChatWidget::OnChatRoomMessageReceived(const FUniqueNetId& UserId, c
 		return;
 	}
 
-	// Show the received chat message.
-	AppendChatMessage(Message.Get());
+	// Show the received chat message along with any other message not displayed yet.
+	AppendNewChatMessages();
+}
+// @@@SNIPEND
+
+#pragma region "Incremental Chat Display"
+void USessionChatWidget::AppendNewChatMessages()
+{
+	if (!SessionChatSubsystem || !W_ActiveChat)
+	{
+		UE_LOG_SESSIONCHAT(Warning, TEXT("Cannot append new chat messages. Session Chat subsystem or chat widget component is not valid."));
+		return;
+	}
+
+	const FString ChatRoomId = SessionChatSubsystem->GetChatRoomIdBasedOnType(CurrentChatRoomType);
+	if (ChatRoomId.IsEmpty())
+	{
+		return;
+	}
+
+	// The chat room changed since the messages were displayed (e.g. the player joined another party), display it from the start.
+	if (!DisplayedChatRoomId.Equals(ChatRoomId))
+	{
+		W_ActiveChat->ClearChatMessages();
+		GetLastChatMessages();
+		return;
+	}
+
+	TArray<TSharedRef<FChatMessage>> NewMessages;
+	LastDisplayedChatSequence = SessionChatSubsystem->GetChatMessagesSince(ChatRoomId, LastDisplayedChatSequence, NewMessages);
+	for (const TSharedRef<FChatMessage>& Message : NewMessages)
+	{
+		AppendChatMessage(Message.Get());
+	}
 }
-// @@@SNIPEND
\ No newline at end of file
+#pragma endregion
\ No newline at end of file
@@ -82,4 +82,12 @@ protected:
 	UCommonButtonBase* Btn_PartyChat;
 #pragma endregion
 // @@@SNIPEND
+
+#pragma region "Incremental Chat Display"
+	/** Append the messages of the current chat room that are not displayed yet. */
+	void AppendNewChatMessages();
+
+	FString DisplayedChatRoomId;
+	int64 LastDisplayedChatSequence = 0;
+#pragma endregion
 };
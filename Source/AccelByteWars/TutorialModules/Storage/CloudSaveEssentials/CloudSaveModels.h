@@ -14,6 +14,29 @@
 #define SOUND_OPTIONS_SFX_KEY FString(TEXT("sfxvolume"))
 // @@@SNIPEND
 
+#define CLOUD_SAVE_LOCAL_CACHE_DIR FString(TEXT("CloudSaveCache"))
+#define CLOUD_SAVE_WRITE_DEBOUNCE_DELAY 2.0f
+// Cloud Save error code returned when the requested player record does not exist.
+#define CLOUD_SAVE_RECORD_NOT_FOUND_ERROR_CODE FString(TEXT("18022"))
+
+// Locally persisted copy of a player record. Reads are served from it and writes are diffed against it.
+struct FCloudSaveLocalRecord
+{
+	int32 LocalUserNum = INDEX_NONE;
+	FString RecordKey;
+	TSharedPtr<FJsonObject> Value;
+
+	// Local revision, incremented on every local change.
+	int32 Version = 0;
+
+	// Backend update time of the record this copy was last synced with. Acts as the record etag.
+	// Only ever set from backend responses, so it is never compared with the client clock.
+	FDateTime RemoteUpdatedAt = FDateTime::MinValue();
+
+	// True if the local copy has changes that are not written to the backend yet.
+	bool bIsDirty = false;
+};
+
 DECLARE_DELEGATE_OneParam(FOnSetCloudSaveRecordComplete, bool /*bWasSuccessful*/);
 
 DECLARE_DELEGATE_TwoParams(FOnGetCloudSaveRecordComplete, bool /*bWasSuccessful*/, FJsonObject& /*Result*/);
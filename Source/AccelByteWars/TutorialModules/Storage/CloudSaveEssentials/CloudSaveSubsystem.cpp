@@ -5,7 +5,10 @@
 #include "CloudSaveSubsystem.h"
 #include "Access/AuthEssentials/AuthEssentialsModels.h"
 #include "OnlineSubsystemAccelByte.h"
+#include "OnlineIdentityInterfaceAccelByte.h"
 #include "OnlineSubsystemUtils.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
 
 #include "Core/System/AccelByteWarsGameInstance.h"
 #include "Core/Player/AccelByteWarsPlayerState.h"
@@ -45,6 +48,9 @@ void UCloudSaveSubsystem::Deinitialize()
 {
 	Super::Deinitialize();
 
+	// Pending changes stay marked as dirty in the local copy and are written on the next sync.
+	GetGameInstance()->GetTimerManager().ClearTimer(PendingFlushTimerHandle);
+
 	UnbindDelegates();
 }
 
@@ -127,6 +133,7 @@ void UCloudSaveSubsystem::OnGetPlayerRecordComplete(
 	if (Result.bSucceeded)
 	{
 		RecordResult = UserRecord.Value.JsonObject.ToSharedRef().Get();
+		LastRemoteUpdatedTimes.Add(GetLocalRecordCacheKey(LocalUserNum, Key), UserRecord.UpdatedAt);
 		UE_LOG_CLOUDSAVE_ESSENTIALS(Log, TEXT("Success to get player record."));
 	}
 	else
@@ -195,11 +202,11 @@ void UCloudSaveSubsystem::OnDeletePlayerRecordComplete(
 
 #pragma region Module.5 General Function Definitions
 // @@@SNIPSTART CloudSaveSubsystem.cpp-BindDelegates
-// @@@MULTISNIP BindPlayerRecordDelegate {"selectedLines": ["1-2", "8-11"]}
-// @@@MULTISNIP PutItAllTogether {"selectedLines": ["1-6", "11"]}
+// @@@MULTISNIP BindPlayerRecordDelegate {"selectedLines": ["1-2", "8-10", "21"]}
+// @@@MULTISNIP PutItAllTogether {"selectedLines": ["1-6", "21"]}
 void UCloudSaveSubsystem::BindDelegates()
 {
-	UAuthEssentialsModels::OnLoginSuccessDelegate.AddUObject(this, &ThisClass::OnLoadGameSoundOptions, TDelegate<void()>());
+	UAuthEssentialsModels::OnLoginSuccessDelegate.AddUObject(this, &ThisClass::OnSyncGameSoundOptions, TDelegate<void()>());
 
 	UOptionsWidget::OnOptionsWidgetActivated.AddUObject(this, &ThisClass::OnLoadGameSoundOptions);
 	UOptionsWidget::OnOptionsWidgetDeactivated.AddUObject(this, &ThisClass::OnSaveGameSoundOptions);
@@ -207,12 +214,22 @@ void UCloudSaveSubsystem::BindDelegates()
 	CloudSaveInterface->OnReplaceUserRecordCompletedDelegates->AddUObject(this, &ThisClass::OnSetPlayerRecordComplete);
 	CloudSaveInterface->OnGetUserRecordCompletedDelegates->AddUObject(this, &ThisClass::OnGetPlayerRecordComplete);
 	CloudSaveInterface->OnDeleteUserRecordCompletedDelegates->AddUObject(this, &ThisClass::OnDeletePlayerRecordComplete);
+
+	const IOnlineSubsystem* Subsystem = Online::GetSubsystem(GetWorld());
+	if (const FOnlineIdentityAccelBytePtr IdentityInterface = Subsystem ? StaticCastSharedPtr<FOnlineIdentityAccelByte>(Subsystem->GetIdentityInterface()) : nullptr)
+	{
+		IdentityInterface->AddOnConnectLobbyCompleteDelegate_Handle(0, FOnConnectLobbyCompleteDelegate::CreateUObject(this, &ThisClass::OnLobbyReconnected));
+	}
+
+	// Completions of the local record requests, removed along with the player record delegates above.
+	CloudSaveInterface->OnReplaceUserRecordCompletedDelegates->AddUObject(this, &ThisClass::OnLocalRecordWriteComplete);
+	CloudSaveInterface->OnGetUserRecordCompletedDelegates->AddUObject(this, &ThisClass::OnLocalRecordReadComplete);
 }
 // @@@SNIPEND
 
 // @@@SNIPSTART CloudSaveSubsystem.cpp-UnbindDelegates
-// @@@MULTISNIP UnbindPlayerRecordDelegate {"selectedLines": ["1-2", "8-11"]}
-// @@@MULTISNIP PutItAllTogether {"selectedLines": ["1-6", "11"]}
+// @@@MULTISNIP UnbindPlayerRecordDelegate {"selectedLines": ["1-2", "8-10", "17"]}
+// @@@MULTISNIP PutItAllTogether {"selectedLines": ["1-6", "17"]}
 void UCloudSaveSubsystem::UnbindDelegates()
 {
 	UAuthEssentialsModels::OnLoginSuccessDelegate.RemoveAll(this);
@@ -223,6 +240,12 @@ void UCloudSaveSubsystem::UnbindDelegates()
 	CloudSaveInterface->OnReplaceUserRecordCompletedDelegates->RemoveAll(this);
 	CloudSaveInterface->OnGetUserRecordCompletedDelegates->RemoveAll(this);
 	CloudSaveInterface->OnDeleteUserRecordCompletedDelegates->RemoveAll(this);
+
+	const IOnlineSubsystem* Subsystem = Online::GetSubsystem(GetWorld());
+	if (const FOnlineIdentityAccelBytePtr IdentityInterface = Subsystem ? StaticCastSharedPtr<FOnlineIdentityAccelByte>(Subsystem->GetIdentityInterface()) : nullptr)
+	{
+		IdentityInterface->ClearOnConnectLobbyCompleteDelegates(0, this);
+	}
 }
 // @@@SNIPEND
 
@@ -235,6 +258,18 @@ void UCloudSaveSubsystem::OnLoadGameSoundOptions(const APlayerController* Player
 		return;
 	}
 
+	const int32 LocalUserNum = GetLocalUserIndex(PlayerController);
+	const FString RecordKey = FString::Printf(TEXT("%s-%s"), *GAME_OPTIONS_KEY, *SOUND_OPTIONS_KEY);
+
+	// Serve the game options from the local copy of the record. It is kept in sync with Cloud Save in the background.
+	if (const FCloudSaveLocalRecord* LocalRecord = GetLocalRecord(LocalUserNum, RecordKey))
+	{
+		UE_LOG_CLOUDSAVE_ESSENTIALS(Log, TEXT("Get game options from the local copy of the Cloud Save record."));
+		ApplyGameSoundOptions(LocalUserNum, *LocalRecord->Value);
+		OnComplete.ExecuteIfBound();
+		return;
+	}
+
 	UAccelByteWarsGameInstance* GameInstance = Cast<UAccelByteWarsGameInstance>(GetGameInstance());
 	ensure(GameInstance);
 
@@ -246,25 +281,21 @@ void UCloudSaveSubsystem::OnLoadGameSoundOptions(const APlayerController* Player
 	// Get game options from Cloud Save.
 	GetPlayerRecord(
 		PlayerController,
-		FString::Printf(TEXT("%s-%s"), *GAME_OPTIONS_KEY, *SOUND_OPTIONS_KEY),
-		FOnGetCloudSaveRecordComplete::CreateWeakLambda(this, [this, GameInstance, PromptSubsystem, OnComplete, PlayerController](bool bWasSuccessful, FJsonObject& Result)
+		RecordKey,
+		FOnGetCloudSaveRecordComplete::CreateWeakLambda(this, [this, PromptSubsystem, OnComplete, LocalUserNum, RecordKey](bool bWasSuccessful, FJsonObject& Result)
 		{
 			UE_LOG_CLOUDSAVE_ESSENTIALS(Warning, TEXT("Get game options from Cloud Save was successful: %s"), bWasSuccessful ? TEXT("True") : TEXT("False"));
 
 			PromptSubsystem->HideLoading();
 
-			// Update the local game options based on the Cloud Save record.
-			double MusicVolume = 0.0f, SFXVolume = 0.0f;
-			if (Result.TryGetNumberField(SOUND_OPTIONS_MUSIC_KEY, MusicVolume))
+			// Keep a local copy of the record, so the next reads do not need to wait for Cloud Save.
+			if (bWasSuccessful && !GetLocalRecord(LocalUserNum, RecordKey))
 			{
-				GameInstance->SetMusicVolume(MusicVolume);
+				UpdateLocalRecord(LocalUserNum, RecordKey, Result, false);
 			}
-			if (Result.TryGetNumberField(SOUND_OPTIONS_SFX_KEY, SFXVolume))
-			{
-				GameInstance->SetSFXVolume(SFXVolume);
-			}
-			
-			GameInstance->SaveGameSettings(GetLocalUserIndex(PlayerController));
+
+			// Update the local game options based on the Cloud Save record.
+			ApplyGameSoundOptions(LocalUserNum, Result);
 
 			OnComplete.ExecuteIfBound();
 		})
@@ -284,31 +315,464 @@ void UCloudSaveSubsystem::OnSaveGameSoundOptions(const APlayerController* Player
 	UAccelByteWarsGameInstance* GameInstance = Cast<UAccelByteWarsGameInstance>(GetGameInstance());
 	ensure(GameInstance);
 
-	UPromptSubsystem* PromptSubsystem = GameInstance->GetSubsystem<UPromptSubsystem>();
-	ensure(PromptSubsystem);
-
-	PromptSubsystem->ShowLoading(LOCTEXT("Saving", "Saving"));
+	const int32 LocalUserNum = GetLocalUserIndex(PlayerController);
+	const FString RecordKey = FString::Printf(TEXT("%s-%s"), *GAME_OPTIONS_KEY, *SOUND_OPTIONS_KEY);
 
 	// Construct game options to save.
 	FJsonObject GameOptionsData;
 	GameOptionsData.SetNumberField(SOUND_OPTIONS_MUSIC_KEY, GameInstance->GetMusicVolume());
 	GameOptionsData.SetNumberField(SOUND_OPTIONS_SFX_KEY, GameInstance->GetSFXVolume());
 
-	// Save the game options to Cloud Save.
-	SetPlayerRecord(
-		PlayerController,
-		FString::Printf(TEXT("%s-%s"), *GAME_OPTIONS_KEY, *SOUND_OPTIONS_KEY),
-		GameOptionsData,
-		FOnSetCloudSaveRecordComplete::CreateWeakLambda(this, [this, PromptSubsystem, OnComplete](bool bWasSuccessful)
+	// Skip the write if nothing changed since the last known record.
+	const FCloudSaveLocalRecord* LocalRecord = GetLocalRecord(LocalUserNum, RecordKey);
+	if (LocalRecord && AreRecordsEqual(*LocalRecord->Value, GameOptionsData))
+	{
+		UE_LOG_CLOUDSAVE_ESSENTIALS(Log, TEXT("Game options are unchanged, skip saving to Cloud Save."));
+		OnComplete.ExecuteIfBound();
+		return;
+	}
+
+	// Save the game options to the local copy first, then write it to Cloud Save in the background.
+	UpdateLocalRecord(LocalUserNum, RecordKey, GameOptionsData, true);
+	SchedulePendingRecordsFlush();
+
+	OnComplete.ExecuteIfBound();
+}
+// @@@SNIPEND
+
+void UCloudSaveSubsystem::OnSyncGameSoundOptions(const APlayerController* PlayerController, TDelegate<void()> OnComplete)
+{
+	if (!PlayerController)
+	{
+		UE_LOG_CLOUDSAVE_ESSENTIALS(Warning, TEXT("Cannot sync game options with Cloud Save. Player Controller is null."));
+		return;
+	}
+
+	const int32 LocalUserNum = GetLocalUserIndex(PlayerController);
+	const FString RecordKey = FString::Printf(TEXT("%s-%s"), *GAME_OPTIONS_KEY, *SOUND_OPTIONS_KEY);
+
+	// Apply the last known game options right away.
+	if (const FCloudSaveLocalRecord* LocalRecord = GetLocalRecord(LocalUserNum, RecordKey))
+	{
+		ApplyGameSoundOptions(LocalUserNum, *LocalRecord->Value);
+	}
+
+	// Reconcile with Cloud Save in the background and apply the result if the backend record wins.
+	SyncPlayerRecord(LocalUserNum, RecordKey, TDelegate<void()>::CreateWeakLambda(this, [this, LocalUserNum, RecordKey, OnComplete]()
+	{
+		if (const FCloudSaveLocalRecord* LocalRecord = GetLocalRecord(LocalUserNum, RecordKey))
 		{
-			UE_LOG_CLOUDSAVE_ESSENTIALS(Warning, TEXT("Set game options from Cloud Save was successful: %s"), bWasSuccessful ? TEXT("True") : TEXT("False"));
+			ApplyGameSoundOptions(LocalUserNum, *LocalRecord->Value);
+		}
 
-			PromptSubsystem->HideLoading();
-			OnComplete.ExecuteIfBound();
+		OnComplete.ExecuteIfBound();
+	}));
+}
+
+void UCloudSaveSubsystem::ApplyGameSoundOptions(const int32 LocalUserNum, const FJsonObject& GameOptionsData) const
+{
+	UAccelByteWarsGameInstance* GameInstance = Cast<UAccelByteWarsGameInstance>(GetGameInstance());
+	ensure(GameInstance);
+
+	// Update the local game options based on the Cloud Save record.
+	double MusicVolume = 0.0f, SFXVolume = 0.0f;
+	if (GameOptionsData.TryGetNumberField(SOUND_OPTIONS_MUSIC_KEY, MusicVolume))
+	{
+		GameInstance->SetMusicVolume(MusicVolume);
+	}
+	if (GameOptionsData.TryGetNumberField(SOUND_OPTIONS_SFX_KEY, SFXVolume))
+	{
+		GameInstance->SetSFXVolume(SFXVolume);
+	}
+
+	GameInstance->SaveGameSettings(LocalUserNum);
+}
+#pragma endregion
+
+#pragma region "Local Record Cache"
+FCloudSaveLocalRecord* UCloudSaveSubsystem::GetLocalRecord(const int32 LocalUserNum, const FString& RecordKey)
+{
+	const FString CacheKey = GetLocalRecordCacheKey(LocalUserNum, RecordKey);
+	if (CacheKey.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	if (FCloudSaveLocalRecord* LocalRecord = LocalRecords.Find(CacheKey))
+	{
+		return LocalRecord;
+	}
+
+	// Not loaded yet, try to load it from the local file.
+	FString JsonStr;
+	if (!FFileHelper::LoadFileToString(JsonStr, *GetLocalRecordFilePath(CacheKey)))
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FJsonObject> JsonObject;
+	const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(JsonStr);
+	const TSharedPtr<FJsonObject>* ValueObject = nullptr;
+	if (!FJsonSerializer::Deserialize(JsonReader, JsonObject) || !JsonObject.IsValid() || !JsonObject->TryGetObjectField(TEXT("Value"), ValueObject))
+	{
+		UE_LOG_CLOUDSAVE_ESSENTIALS(Warning, TEXT("Failed to load local player record from: %s"), *GetLocalRecordFilePath(CacheKey));
+		return nullptr;
+	}
+
+	FCloudSaveLocalRecord LocalRecord;
+	LocalRecord.LocalUserNum = LocalUserNum;
+	LocalRecord.RecordKey = RecordKey;
+	LocalRecord.Value = *ValueObject;
+	JsonObject->TryGetNumberField(TEXT("Version"), LocalRecord.Version);
+	JsonObject->TryGetBoolField(TEXT("IsDirty"), LocalRecord.bIsDirty);
+
+	FString DateTimeStr;
+	if (JsonObject->TryGetStringField(TEXT("RemoteUpdatedAt"), DateTimeStr))
+	{
+		FDateTime::ParseIso8601(*DateTimeStr, LocalRecord.RemoteUpdatedAt);
+	}
+
+	UE_LOG_CLOUDSAVE_ESSENTIALS(Log, TEXT("Success to load local player record from: %s"), *GetLocalRecordFilePath(CacheKey));
+	return &LocalRecords.Add(CacheKey, LocalRecord);
+}
+
+FCloudSaveLocalRecord& UCloudSaveSubsystem::UpdateLocalRecord(const int32 LocalUserNum, const FString& RecordKey, const FJsonObject& RecordData, const bool bIsLocalChange)
+{
+	const FString CacheKey = GetLocalRecordCacheKey(LocalUserNum, RecordKey);
+
+	FCloudSaveLocalRecord& LocalRecord = LocalRecords.FindOrAdd(CacheKey);
+	LocalRecord.LocalUserNum = LocalUserNum;
+	LocalRecord.RecordKey = RecordKey;
+	LocalRecord.Value = MakeShared<FJsonObject>(RecordData);
+	LocalRecord.Version++;
+
+	if (bIsLocalChange)
+	{
+		LocalRecord.bIsDirty = true;
+	}
+	else
+	{
+		// The data comes from the backend, so the local copy is now in sync with it.
+		if (const FDateTime* RemoteUpdatedAt = LastRemoteUpdatedTimes.Find(CacheKey))
+		{
+			LocalRecord.RemoteUpdatedAt = *RemoteUpdatedAt;
 		}
-	));
+		LocalRecord.bIsDirty = false;
+	}
+
+	if (!CacheKey.IsEmpty())
+	{
+		SaveLocalRecord(CacheKey);
+	}
+
+	return LocalRecord;
+}
+
+bool UCloudSaveSubsystem::SaveLocalRecord(const FString& CacheKey) const
+{
+	const FCloudSaveLocalRecord* LocalRecord = LocalRecords.Find(CacheKey);
+	if (!LocalRecord || !LocalRecord->Value.IsValid())
+	{
+		return false;
+	}
+
+	TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetObjectField(TEXT("Value"), LocalRecord->Value);
+	JsonObject->SetNumberField(TEXT("Version"), LocalRecord->Version);
+	JsonObject->SetBoolField(TEXT("IsDirty"), LocalRecord->bIsDirty);
+	JsonObject->SetStringField(TEXT("RemoteUpdatedAt"), LocalRecord->RemoteUpdatedAt.ToIso8601());
+
+	FString JsonStr;
+	const TSharedRef<TJsonWriter<TCHAR>> JsonWriter = TJsonWriterFactory<TCHAR>::Create(&JsonStr);
+	if (FJsonSerializer::Serialize(JsonObject, JsonWriter) && FFileHelper::SaveStringToFile(JsonStr, *GetLocalRecordFilePath(CacheKey)))
+	{
+		return true;
+	}
+
+	UE_LOG_CLOUDSAVE_ESSENTIALS(Warning, TEXT("Failed to save local player record to: %s"), *GetLocalRecordFilePath(CacheKey));
+	return false;
+}
+
+void UCloudSaveSubsystem::SyncPlayerRecord(const int32 LocalUserNum, const FString& RecordKey, const TDelegate<void()>& OnComplete)
+{
+	if (!ensure(CloudSaveInterface.IsValid()))
+	{
+		UE_LOG_CLOUDSAVE_ESSENTIALS(Warning, TEXT("Cloud Save interface is not valid."));
+		OnComplete.ExecuteIfBound();
+		return;
+	}
+
+	const FString CacheKey = GetLocalRecordCacheKey(LocalUserNum, RecordKey);
+	if (CacheKey.IsEmpty())
+	{
+		UE_LOG_CLOUDSAVE_ESSENTIALS(Warning, TEXT("Cannot sync player record %s. User is not logged in."), *RecordKey);
+		OnComplete.ExecuteIfBound();
+		return;
+	}
+
+	// If the record is being read or written, the sync starts once that request completes.
+	PendingRecordSyncs.Add(CacheKey, OnComplete);
+	if (!IsLocalRecordRequestInFlight(CacheKey))
+	{
+		ReadPlayerRecordForSync(LocalUserNum, RecordKey);
+	}
+}
+
+void UCloudSaveSubsystem::ReadPlayerRecordForSync(const int32 LocalUserNum, const FString& RecordKey)
+{
+	const FString CacheKey = GetLocalRecordCacheKey(LocalUserNum, RecordKey);
+
+	// This read serves every sync requested so far.
+	TArray<TDelegate<void()>> OnSyncCompletes;
+	PendingRecordSyncs.MultiFind(CacheKey, OnSyncCompletes, true);
+	PendingRecordSyncs.Remove(CacheKey);
+
+	LocalRecordReadRequests.Add(CacheKey, FOnCloudSaveLocalRecordReadComplete::CreateWeakLambda(this, [this, LocalUserNum, RecordKey, CacheKey, OnSyncCompletes](const FOnlineError& Result, const FAccelByteModelsUserRecord& UserRecord)
+	{
+		const bool bIsRecordMissing = !Result.bSucceeded && IsRecordNotFoundError(Result);
+		if (!Result.bSucceeded && !bIsRecordMissing)
+		{
+			// The backend state is unknown, keep the local changes dirty and resolve them on the next sync.
+			UE_LOG_CLOUDSAVE_ESSENTIALS(Warning, TEXT("Failed to sync player record %s, will retry later. Error %s: %s"), *RecordKey, *Result.ErrorCode, *Result.ErrorMessage.ToString());
+		}
+		else
+		{
+			FJsonObject RemoteValue;
+			if (Result.bSucceeded && UserRecord.Value.JsonObject.IsValid())
+			{
+				RemoteValue = *UserRecord.Value.JsonObject;
+			}
+
+			FCloudSaveLocalRecord* LocalRecord = GetLocalRecord(LocalUserNum, RecordKey);
+			const FDateTime RemoteUpdatedAt = LastRemoteUpdatedTimes.FindRef(CacheKey);
+
+			if (!LocalRecord)
+			{
+				// Nothing local yet, take the backend record as is.
+				if (Result.bSucceeded)
+				{
+					UpdateLocalRecord(LocalUserNum, RecordKey, RemoteValue, false);
+				}
+			}
+			else if (!LocalRecord->bIsDirty)
+			{
+				// No local changes, the backend record always wins.
+				if (Result.bSucceeded && (RemoteUpdatedAt != LocalRecord->RemoteUpdatedAt || !AreRecordsEqual(*LocalRecord->Value, RemoteValue)))
+				{
+					UpdateLocalRecord(LocalUserNum, RecordKey, RemoteValue, false);
+				}
+			}
+			else if (bIsRecordMissing || RemoteUpdatedAt <= LocalRecord->RemoteUpdatedAt)
+			{
+				// The record is missing in the backend or unchanged since the local copy was based on it.
+				// Both times come from the backend, so the client clock never decides the winner.
+				UE_LOG_CLOUDSAVE_ESSENTIALS(Log, TEXT("Local player record %s is newer than the backend, writing it."), *RecordKey);
+				WriteLocalRecord(CacheKey);
+			}
+			else
+			{
+				// Both sides changed since the last sync, the backend change wins.
+				UE_LOG_CLOUDSAVE_ESSENTIALS(Log, TEXT("Backend player record %s is newer than the local changes, discarding local changes."), *RecordKey);
+				UpdateLocalRecord(LocalUserNum, RecordKey, RemoteValue, false);
+			}
+		}
+
+		for (const TDelegate<void()>& OnSyncComplete : OnSyncCompletes)
+		{
+			OnSyncComplete.ExecuteIfBound();
+		}
+
+		ProcessNextLocalRecordRequest(LocalUserNum, RecordKey, false);
+	}));
+	CloudSaveInterface->GetUserRecord(LocalUserNum, RecordKey);
+}
+
+void UCloudSaveSubsystem::WriteLocalRecord(const FString& CacheKey)
+{
+	const FCloudSaveLocalRecord* LocalRecord = LocalRecords.Find(CacheKey);
+	if (!LocalRecord || !LocalRecord->bIsDirty || !ensure(CloudSaveInterface.IsValid()))
+	{
+		return;
+	}
+
+	// Only one write per record at a time. The record is flushed again when the request in flight completes.
+	if (IsLocalRecordRequestInFlight(CacheKey))
+	{
+		return;
+	}
+
+	const int32 LocalUserNum = LocalRecord->LocalUserNum;
+	const FString RecordKey = LocalRecord->RecordKey;
+	const int32 SentVersion = LocalRecord->Version;
+	const TSharedPtr<FJsonObject> SentValue = LocalRecord->Value;
+	LocalRecordWriteRequests.Add(CacheKey, FOnCloudSaveLocalRecordWriteComplete::CreateWeakLambda(this, [this, CacheKey, LocalUserNum, RecordKey, SentVersion, SentValue](const FOnlineError& Result)
+	{
+		FCloudSaveLocalRecord* WrittenRecord = LocalRecords.Find(CacheKey);
+		if (!WrittenRecord || !Result.bSucceeded)
+		{
+			// Keep the record dirty, it will be written again on the next change or reconnect.
+			UE_LOG_CLOUDSAVE_ESSENTIALS(Warning, TEXT("Failed to write local player record %s, will retry later. Error %s: %s"), *RecordKey, *Result.ErrorCode, *Result.ErrorMessage.ToString());
+			ProcessNextLocalRecordRequest(LocalUserNum, RecordKey, false);
+			return;
+		}
+
+		// Only clear the dirty flag if nothing changed while the write was in flight.
+		if (WrittenRecord->Version == SentVersion)
+		{
+			WrittenRecord->bIsDirty = false;
+		}
+		SaveLocalRecord(CacheKey);
+
+		// The write completion doesn't carry the backend update time, read the record back to get it.
+		LocalRecordReadRequests.Add(CacheKey, FOnCloudSaveLocalRecordReadComplete::CreateWeakLambda(this, [this, CacheKey, LocalUserNum, RecordKey, SentValue](const FOnlineError& ReadResult, const FAccelByteModelsUserRecord& UserRecord)
+		{
+			FCloudSaveLocalRecord* SyncedRecord = LocalRecords.Find(CacheKey);
+			if (SyncedRecord && ReadResult.bSucceeded && SentValue.IsValid() && UserRecord.Value.JsonObject.IsValid())
+			{
+				// If someone else wrote in between, keep the old etag so the next sync resolves the conflict.
+				if (AreRecordsEqual(*SentValue, *UserRecord.Value.JsonObject))
+				{
+					SyncedRecord->RemoteUpdatedAt = UserRecord.UpdatedAt;
+					SaveLocalRecord(CacheKey);
+				}
+			}
+
+			// Write the changes made while this write was in flight.
+			ProcessNextLocalRecordRequest(LocalUserNum, RecordKey, true);
+		}));
+		CloudSaveInterface->GetUserRecord(LocalUserNum, RecordKey);
+	}));
+	CloudSaveInterface->ReplaceUserRecord(LocalUserNum, RecordKey, *LocalRecord->Value);
+}
+
+void UCloudSaveSubsystem::ProcessNextLocalRecordRequest(const int32 LocalUserNum, const FString& RecordKey, const bool bFlushDirtyRecord)
+{
+	const FString CacheKey = GetLocalRecordCacheKey(LocalUserNum, RecordKey);
+	if (CacheKey.IsEmpty() || IsLocalRecordRequestInFlight(CacheKey))
+	{
+		return;
+	}
+
+	// A sync reads the record first and writes the local changes if they win, so it takes priority.
+	if (PendingRecordSyncs.Contains(CacheKey))
+	{
+		ReadPlayerRecordForSync(LocalUserNum, RecordKey);
+	}
+	else if (bFlushDirtyRecord)
+	{
+		WriteLocalRecord(CacheKey);
+	}
+}
+
+bool UCloudSaveSubsystem::IsLocalRecordRequestInFlight(const FString& CacheKey) const
+{
+	return LocalRecordWriteRequests.Contains(CacheKey) || LocalRecordReadRequests.Contains(CacheKey);
+}
+
+void UCloudSaveSubsystem::SchedulePendingRecordsFlush()
+{
+	// Restart the timer on every change, so a burst of changes is written once.
+	GetGameInstance()->GetTimerManager().SetTimer(
+		PendingFlushTimerHandle,
+		FTimerDelegate::CreateUObject(this, &ThisClass::FlushPendingRecords),
+		CLOUD_SAVE_WRITE_DEBOUNCE_DELAY,
+		false);
+}
+
+void UCloudSaveSubsystem::FlushPendingRecords()
+{
+	for (const TPair<FString, FCloudSaveLocalRecord>& LocalRecord : LocalRecords)
+	{
+		if (LocalRecord.Value.bIsDirty)
+		{
+			WriteLocalRecord(LocalRecord.Key);
+		}
+	}
+}
+
+void UCloudSaveSubsystem::OnLobbyReconnected(int32 LocalUserNum, bool bWasSuccessful, const FUniqueNetId& UserId, const FString& Error)
+{
+	if (!bWasSuccessful)
+	{
+		return;
+	}
+
+	// Resolve the local changes that could not be written while disconnected.
+	TArray<FString> DirtyRecordKeys;
+	for (const TPair<FString, FCloudSaveLocalRecord>& LocalRecord : LocalRecords)
+	{
+		if (LocalRecord.Value.bIsDirty && LocalRecord.Value.LocalUserNum == LocalUserNum)
+		{
+			DirtyRecordKeys.Add(LocalRecord.Value.RecordKey);
+		}
+	}
+
+	for (const FString& RecordKey : DirtyRecordKeys)
+	{
+		SyncPlayerRecord(LocalUserNum, RecordKey, TDelegate<void()>());
+	}
+}
+
+void UCloudSaveSubsystem::OnLocalRecordWriteComplete(int32 LocalUserNum, const FOnlineError& Result, const FString& Key)
+{
+	FOnCloudSaveLocalRecordWriteComplete OnWriteComplete;
+	if (LocalRecordWriteRequests.RemoveAndCopyValue(GetLocalRecordCacheKey(LocalUserNum, Key), OnWriteComplete))
+	{
+		OnWriteComplete.ExecuteIfBound(Result);
+	}
+}
+
+void UCloudSaveSubsystem::OnLocalRecordReadComplete(int32 LocalUserNum, const FOnlineError& Result, const FString& Key, const FAccelByteModelsUserRecord& UserRecord)
+{
+	const FString CacheKey = GetLocalRecordCacheKey(LocalUserNum, Key);
+	if (Result.bSucceeded)
+	{
+		LastRemoteUpdatedTimes.Add(CacheKey, UserRecord.UpdatedAt);
+	}
+
+	FOnCloudSaveLocalRecordReadComplete OnReadComplete;
+	if (LocalRecordReadRequests.RemoveAndCopyValue(CacheKey, OnReadComplete))
+	{
+		OnReadComplete.ExecuteIfBound(Result, UserRecord);
+	}
+}
+
+FString UCloudSaveSubsystem::GetLocalRecordCacheKey(const int32 LocalUserNum, const FString& RecordKey) const
+{
+	const IOnlineSubsystem* Subsystem = Online::GetSubsystem(GetWorld());
+	const IOnlineIdentityPtr IdentityInterface = Subsystem ? Subsystem->GetIdentityInterface() : nullptr;
+	const FUniqueNetIdPtr UserId = IdentityInterface ? IdentityInterface->GetUniquePlayerId(LocalUserNum) : nullptr;
+	if (!UserId.IsValid())
+	{
+		return FString();
+	}
+
+	// Records are stored per user, so different accounts on the same machine do not share options.
+	const FUniqueNetIdAccelByteUserPtr AccelByteUserId = FUniqueNetIdAccelByteUser::TryCast(*UserId);
+	const FString UserIdStr = AccelByteUserId.IsValid() ? AccelByteUserId->GetAccelByteId() : UserId->ToString();
+	return FString::Printf(TEXT("%s/%s"), *UserIdStr, *RecordKey);
+}
+
+FString UCloudSaveSubsystem::GetLocalRecordFilePath(const FString& CacheKey) const
+{
+	FString CachePath = TEXT("");
+#if (defined(PLATFORM_PS4) && PLATFORM_PS4) || (defined(PLATFORM_PS5) && PLATFORM_PS5)
+	CachePath = FPaths::ProjectPersistentDownloadDir();
+#else
+	CachePath = FPaths::ProjectSavedDir();
+#endif
+	return FPaths::Combine(CachePath, CLOUD_SAVE_LOCAL_CACHE_DIR, FString::Printf(TEXT("%s.json"), *CacheKey));
+}
+
+bool UCloudSaveSubsystem::AreRecordsEqual(const FJsonObject& A, const FJsonObject& B)
+{
+	return FJsonValue::CompareEqual(FJsonValueObject(MakeShared<FJsonObject>(A)), FJsonValueObject(MakeShared<FJsonObject>(B)));
+}
+
+bool UCloudSaveSubsystem::IsRecordNotFoundError(const FOnlineError& Result)
+{
+	return Result.ErrorCode.Contains(CLOUD_SAVE_RECORD_NOT_FOUND_ERROR_CODE) || Result.ErrorRaw.Contains(CLOUD_SAVE_RECORD_NOT_FOUND_ERROR_CODE);
 }
-// @@@SNIPEND
 #pragma endregion
 
 #pragma region "Utilities"
@@ -16,6 +16,9 @@ class AAccelByteWarsPlayerPawn;
 class AAccelByteWarsPlayerState;
 class UPromptSubsystem;
 
+DECLARE_DELEGATE_OneParam(FOnCloudSaveLocalRecordWriteComplete, const FOnlineError& /*Result*/);
+DECLARE_DELEGATE_TwoParams(FOnCloudSaveLocalRecordReadComplete, const FOnlineError& /*Result*/, const FAccelByteModelsUserRecord& /*UserRecord*/);
+
 UCLASS()
 class ACCELBYTEWARS_API UCloudSaveSubsystem : public UTutorialModuleSubsystem
 {
@@ -73,6 +76,45 @@ private:
 
 	void OnLoadGameSoundOptions(const APlayerController* PlayerController, TDelegate<void()> OnComplete);
 	void OnSaveGameSoundOptions(const APlayerController* PlayerController, TDelegate<void()> OnComplete);
+	void OnSyncGameSoundOptions(const APlayerController* PlayerController, TDelegate<void()> OnComplete);
+	void ApplyGameSoundOptions(const int32 LocalUserNum, const FJsonObject& GameOptionsData) const;
+
+#pragma region "Local Record Cache"
+	FCloudSaveLocalRecord* GetLocalRecord(const int32 LocalUserNum, const FString& RecordKey);
+	FCloudSaveLocalRecord& UpdateLocalRecord(const int32 LocalUserNum, const FString& RecordKey, const FJsonObject& RecordData, const bool bIsLocalChange);
+	bool SaveLocalRecord(const FString& CacheKey) const;
+
+	void SyncPlayerRecord(const int32 LocalUserNum, const FString& RecordKey, const TDelegate<void()>& OnComplete);
+	void ReadPlayerRecordForSync(const int32 LocalUserNum, const FString& RecordKey);
+	void WriteLocalRecord(const FString& CacheKey);
+	void ProcessNextLocalRecordRequest(const int32 LocalUserNum, const FString& RecordKey, const bool bFlushDirtyRecord);
+	bool IsLocalRecordRequestInFlight(const FString& CacheKey) const;
+	void SchedulePendingRecordsFlush();
+	void FlushPendingRecords();
+	void OnLobbyReconnected(int32 LocalUserNum, bool bWasSuccessful, const FUniqueNetId& UserId, const FString& Error);
+
+	void OnLocalRecordWriteComplete(int32 LocalUserNum, const FOnlineError& Result, const FString& Key);
+	void OnLocalRecordReadComplete(int32 LocalUserNum, const FOnlineError& Result, const FString& Key, const FAccelByteModelsUserRecord& UserRecord);
+
+	FString GetLocalRecordCacheKey(const int32 LocalUserNum, const FString& RecordKey) const;
+	FString GetLocalRecordFilePath(const FString& CacheKey) const;
+	static bool AreRecordsEqual(const FJsonObject& A, const FJsonObject& B);
+	static bool IsRecordNotFoundError(const FOnlineError& Result);
+
+	TMap<FString, FCloudSaveLocalRecord> LocalRecords;
+
+	// Backend update time of the records from the last successful get, keyed by local record cache key (user and record key).
+	TMap<FString, FDateTime> LastRemoteUpdatedTimes;
+
+	// At most one read or write of a local record is in flight at a time, so its completion belongs to exactly one request.
+	TMap<FString /*CacheKey*/, FOnCloudSaveLocalRecordWriteComplete> LocalRecordWriteRequests;
+	TMap<FString /*CacheKey*/, FOnCloudSaveLocalRecordReadComplete> LocalRecordReadRequests;
+
+	// Syncs requested while another request of the same record was in flight, started once it completes.
+	TMultiMap<FString /*CacheKey*/, TDelegate<void()>> PendingRecordSyncs;
+
+	FTimerHandle PendingFlushTimerHandle;
+#pragma endregion
 
 #pragma region "Utilities"
 	
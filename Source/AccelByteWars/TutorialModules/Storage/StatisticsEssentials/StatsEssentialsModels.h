@@ -0,0 +1,41 @@
+// Copyright (c) 2024 AccelByte Inc. All Rights Reserved.
+// This is licensed software from AccelByte Inc, for limitations
+// and restrictions contact your company contract manager.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OnlineStatisticInterfaceAccelByte.h"
+
+#define STATS_JOURNAL_VERSION 1
+#define STATS_JOURNAL_DIR FString(TEXT("StatsJournal"))
+#define STATS_JOURNAL_RETRY_BASE_DELAY 2.0f
+#define STATS_JOURNAL_RETRY_MAX_DELAY 60.0f
+#define STATS_JOURNAL_MAX_RETRIES 5
+#define STATS_JOURNAL_MAX_TOTAL_ATTEMPTS 20
+#define STATS_JOURNAL_MAX_AGE FTimespan::FromDays(7)
+
+// Stats update kept in the local journal until the backend accepts it, so a failed update can be sent again.
+struct FStatsJournalEntry
+{
+	FGuid EntryId;
+	int32 LocalUserNum = 0;
+
+	// User whose credentials send the update. Empty if the update is sent by the dedicated server.
+	FString OwnerUserId;
+
+	TArray<FOnlineStatsUserUpdatedStats> UpdatedUsersStats;
+
+	// Failed attempts since the entry was last queued or loaded, used to back off the retries. Not persisted.
+	int32 RetryAttempts = 0;
+
+	// Failed attempts across all games and launches. Once it reaches STATS_JOURNAL_MAX_TOTAL_ATTEMPTS the entry is dropped.
+	int32 TotalAttempts = 0;
+
+	// Time the update was journaled. Once it is older than STATS_JOURNAL_MAX_AGE the entry is dropped.
+	FDateTime CreatedAt = FDateTime::UtcNow();
+
+	// Completion delegates of the original request, executed once on the first attempt. Not persisted.
+	FOnlineStatsUpdateStatsComplete OnCompleteClient;
+	FOnUpdateMultipleUserStatItemsComplete OnCompleteServer;
+};
@@ -7,6 +7,9 @@
 
 #include "OnlineSubsystem.h"
 #include "OnlineSubsystemUtils.h"
+#include "Misc/FileHelper.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
 #include "Core/AssetManager/TutorialModules/TutorialModuleUtility.h"
 #include "Core/System/AccelByteWarsGameInstance.h"
 #include "Core/GameModes/AccelByteWarsInGameGameMode.h"
@@ -31,6 +34,19 @@ void UStatsEssentialsSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 	if (UTutorialModuleUtility::IsTutorialModuleActive(FPrimaryAssetId{ "TutorialModule:STATSESSENTIALS" }, this))
 	{
 		AAccelByteWarsInGameGameMode::OnGameEndsDelegate.AddUObject(this, &ThisClass::UpdateConnectedPlayersStatsOnGameEnds);
+
+		// A new game is the next opportunity to send the journaled stats updates that failed before.
+		AAccelByteWarsInGameGameMode::OnGameStartedDelegates.AddWeakLambda(this, [this]()
+		{
+			for (FStatsJournalEntry& Entry : StatsJournal)
+			{
+				Entry.RetryAttempts = 0;
+			}
+			FlushStatsJournal();
+		});
+
+		LoadStatsJournal();
+		FlushStatsJournal();
 	}
 }
 
@@ -156,6 +172,33 @@ bool UStatsEssentialsSubsystem::UpdateConnectedPlayersStats(
 		return false;
 	}
 
+	// Aggregate the stats of each team once, instead of copying the team data for every player.
+	struct FTeamStatsTotals
+	{
+		float Score = 0.0f;
+		int32 KillCount = 0;
+		int32 Deaths = 0;
+	};
+
+	TMap<int32, FTeamStatsTotals> TeamStatsTotals;
+	TeamStatsTotals.Reserve(GameState->Teams.Num());
+	for (const FGameplayTeamData& Team : GameState->Teams)
+	{
+		FTeamStatsTotals& Totals = TeamStatsTotals.Add(Team.TeamId);
+		Totals.Score = Team.GetTeamScore();
+		Totals.KillCount = Team.GetTeamKillCount();
+		Totals.Deaths = Team.GetTeamDeaths();
+	}
+
+	/* Local gameplay only has one valid account, which is the player who logged in to the game.
+	 * Thus, set the stats based on the highest team data.*/
+	FTeamStatsTotals HighestTeamStats;
+	if (bIsLocalGame)
+	{
+		int32 HighestTeamLives = 0;
+		GameState->GetHighestTeamData(HighestTeamStats.Score, HighestTeamLives, HighestTeamStats.KillCount, HighestTeamStats.Deaths);
+	}
+
 	// Update players' stats.
 	TArray<FOnlineStatsUserUpdatedStats> UpdatedUsersStats;
 	const int32 WinnerTeamId = GameState->GetWinnerTeamId();
@@ -181,25 +224,16 @@ bool UStatsEssentialsSubsystem::UpdateConnectedPlayersStats(
 			continue;
 		}
 
-		FGameplayTeamData TeamData{};
-		float TeamScore = 0;
-		int32 TeamTotalLives = 0, TeamTotalKillCount = 0, TeamTotalDeaths = 0;
-
-		/* Local gameplay only has one valid account, which is the player who logged in to the game.
-		 * Thus, set the stats based on the highest team data.*/
-		if (bIsLocalGame)
-		{
-			GameState->GetHighestTeamData(TeamScore, TeamTotalLives, TeamTotalKillCount, TeamTotalDeaths);
-		}
 		// Each connected player account in online gameplay is valid, so set the stats based on their respective teams.
-		else 
-		{
-			GameState->GetTeamDataByTeamId(ABPlayerState->TeamId, TeamData, TeamScore, TeamTotalLives, TeamTotalKillCount, TeamTotalDeaths);
-		}
+		// Local gameplay uses the highest team data instead.
+		const FTeamStatsTotals* TeamStats = bIsLocalGame ? &HighestTeamStats : TeamStatsTotals.Find(ABPlayerState->TeamId);
+		const float TeamScore = TeamStats ? TeamStats->Score : 0.0f;
+		const int32 TeamTotalKillCount = TeamStats ? TeamStats->KillCount : 0;
+		const int32 TeamTotalDeaths = TeamStats ? TeamStats->Deaths : 0;
 
 		/* If the gameplay is local, set the winner status based on if the game ends in a draw or not.
 		 * If the gameplay is online, set the winner status based on whether the team ID matches with the winning team ID.*/
-		const bool bIsWinner = bIsLocalGame ? WinnerTeamId != INDEX_NONE : TeamData.TeamId == WinnerTeamId;
+		const bool bIsWinner = bIsLocalGame ? WinnerTeamId != INDEX_NONE : (TeamStats && ABPlayerState->TeamId == WinnerTeamId);
 
 		FOnlineStatsUserUpdatedStats UpdatedUserStats(PlayerUniqueId->AsShared());
 		// Reset statistics values to zero.
@@ -276,8 +310,8 @@ bool UStatsEssentialsSubsystem::UpdateConnectedPlayersStats(
 		UpdatedUsersStats.Add(UpdatedUserStats);
 	}
 
-	// Update stats
-	return UpdateUsersStats(LocalUserNum, UpdatedUsersStats, OnCompleteClient, OnCompleteServer);
+	// Journal the stats first, so they can be sent again if the update fails.
+	return SubmitUsersStats(LocalUserNum, UpdatedUsersStats, OnCompleteClient, OnCompleteServer);
 }
 // @@@SNIPEND
 
@@ -301,3 +335,444 @@ void UStatsEssentialsSubsystem::UpdateConnectedPlayersStatsOnGameEnds(const FStr
 	}
 }
 // @@@SNIPEND
+
+#pragma region "Stats Journal"
+bool UStatsEssentialsSubsystem::SubmitUsersStats(
+	const int32 LocalUserNum,
+	const TArray<FOnlineStatsUserUpdatedStats>& UpdatedUsersStats,
+	const FOnlineStatsUpdateStatsComplete& OnCompleteClient,
+	const FOnUpdateMultipleUserStatItemsComplete& OnCompleteServer)
+{
+	if (UpdatedUsersStats.IsEmpty())
+	{
+		UE_LOG_STATSESSENTIALS(Log, TEXT("No users' statistics to update."));
+		return false;
+	}
+
+	FStatsJournalEntry& Entry = StatsJournal.AddDefaulted_GetRef();
+	Entry.EntryId = FGuid::NewGuid();
+	Entry.LocalUserNum = LocalUserNum;
+	Entry.UpdatedUsersStats = UpdatedUsersStats;
+	Entry.OnCompleteClient = OnCompleteClient;
+	Entry.OnCompleteServer = OnCompleteServer;
+	if (!IsRunningDedicatedServer())
+	{
+		const FUniqueNetIdPtr LocalUserId = IdentityPtr->GetUniquePlayerId(LocalUserNum);
+		Entry.OwnerUserId = LocalUserId.IsValid() ? LocalUserId->ToString() : FString();
+	}
+
+	SaveStatsJournal();
+
+	// The update is sent right away, unless another update is being sent or waiting for its retry.
+	FlushStatsJournal();
+	return true;
+}
+
+void UStatsEssentialsSubsystem::FlushStatsJournal()
+{
+	if (SendingStatsJournalEntryId.IsValid() || GetGameInstance()->GetTimerManager().IsTimerActive(StatsJournalRetryTimerHandle))
+	{
+		return;
+	}
+
+	// Drop the updates that kept failing for too long, so they don't block the later updates of the same user stats forever.
+	bool bHasDroppedEntries = false;
+	for (int32 EntryIndex = StatsJournal.Num() - 1; EntryIndex >= 0; EntryIndex--)
+	{
+		if (HasStatsJournalEntryExpired(StatsJournal[EntryIndex]))
+		{
+			DropStatsJournalEntry(EntryIndex, TEXT("too many failed attempts or too old"));
+			bHasDroppedEntries = true;
+		}
+	}
+	if (bHasDroppedEntries)
+	{
+		SaveStatsJournal();
+	}
+
+	// Updates of the same user stat must reach the backend in journal order, e.g. a reset must not land after a later sum.
+	// Once an entry can't be sent, every later entry touching one of its user stats waits for it.
+	TSet<FString> BlockedUserStats;
+	for (const FStatsJournalEntry& Entry : StatsJournal)
+	{
+		TArray<FString> EntryUserStats;
+		bool bIsBlocked = false;
+		for (const FOnlineStatsUserUpdatedStats& UserStats : Entry.UpdatedUsersStats)
+		{
+			for (const TPair<FString, FOnlineStatUpdate>& Stat : UserStats.Stats)
+			{
+				const FString UserStat = FString::Printf(TEXT("%s/%s"), *UserStats.Account->ToString(), *Stat.Key);
+				bIsBlocked |= BlockedUserStats.Contains(UserStat);
+				EntryUserStats.Add(UserStat);
+			}
+		}
+
+		if (bIsBlocked || !CanSendStatsJournalEntry(Entry))
+		{
+			BlockedUserStats.Append(EntryUserStats);
+			continue;
+		}
+
+		const FGuid EntryId = Entry.EntryId;
+		SendingStatsJournalEntryId = EntryId;
+		const bool bStarted = UpdateUsersStats(
+			Entry.LocalUserNum,
+			Entry.UpdatedUsersStats,
+			FOnlineStatsUpdateStatsComplete::CreateWeakLambda(this, [this, EntryId](const FOnlineError& ResultState)
+			{
+				if (FStatsJournalEntry* SentEntry = FindStatsJournalEntry(EntryId))
+				{
+					SentEntry->OnCompleteClient.ExecuteIfBound(ResultState);
+					SentEntry->OnCompleteClient.Unbind();
+				}
+				OnStatsJournalEntrySent(EntryId, ResultState);
+			}),
+			FOnUpdateMultipleUserStatItemsComplete::CreateWeakLambda(this, [this, EntryId](const FOnlineError& ResultState, const TArray<FAccelByteModelsUpdateUserStatItemsResponse>& Result)
+			{
+				if (FStatsJournalEntry* SentEntry = FindStatsJournalEntry(EntryId))
+				{
+					SentEntry->OnCompleteServer.ExecuteIfBound(ResultState, Result);
+					SentEntry->OnCompleteServer.Unbind();
+				}
+				OnStatsJournalEntrySent(EntryId, ResultState);
+			}));
+
+		if (!bStarted)
+		{
+			// Another stats update is in progress, try again later.
+			SendingStatsJournalEntryId.Invalidate();
+			ScheduleStatsJournalRetry(1);
+		}
+		return;
+	}
+}
+
+void UStatsEssentialsSubsystem::OnStatsJournalEntrySent(const FGuid EntryId, const FOnlineError& Result)
+{
+	SendingStatsJournalEntryId.Invalidate();
+
+	const int32 EntryIndex = StatsJournal.IndexOfByPredicate([&EntryId](const FStatsJournalEntry& Entry) { return Entry.EntryId == EntryId; });
+	if (!StatsJournal.IsValidIndex(EntryIndex))
+	{
+		return;
+	}
+
+	if (Result.bSucceeded)
+	{
+		UE_LOG_STATSESSENTIALS(Log, TEXT("Journaled statistics update %s is sent."), *EntryId.ToString());
+		StatsJournal.RemoveAt(EntryIndex);
+		SaveStatsJournal();
+
+		// The update delegates are only released after this callback returns, so send the next entry on the next tick.
+		GetGameInstance()->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &ThisClass::FlushStatsJournal));
+		return;
+	}
+
+	FStatsJournalEntry& FailedEntry = StatsJournal[EntryIndex];
+	FailedEntry.RetryAttempts++;
+	FailedEntry.TotalAttempts++;
+
+	// Sending a rejected update again can't succeed, and an expired one has been retried long enough.
+	const bool bIsRetryable = IsStatsJournalErrorRetryable(Result);
+	if (!bIsRetryable || HasStatsJournalEntryExpired(FailedEntry))
+	{
+		DropStatsJournalEntry(
+			EntryIndex,
+			bIsRetryable ?
+			TEXT("too many failed attempts or too old") :
+			FString::Printf(TEXT("rejected by the backend. Error %s: %s"), *Result.ErrorCode, *Result.ErrorMessage.ToString()));
+		SaveStatsJournal();
+
+		// The later updates of the same user stats are no longer blocked by it.
+		GetGameInstance()->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &ThisClass::FlushStatsJournal));
+		return;
+	}
+	SaveStatsJournal();
+
+	if (FailedEntry.RetryAttempts >= STATS_JOURNAL_MAX_RETRIES)
+	{
+		// Keep the update in the journal, it is sent again on the next game or the next launch.
+		UE_LOG_STATSESSENTIALS(Warning, TEXT("Failed to send journaled statistics update %s after %d attempts. Retrying on the next game."), *EntryId.ToString(), FailedEntry.RetryAttempts);
+		return;
+	}
+
+	UE_LOG_STATSESSENTIALS(Warning, TEXT("Failed to send journaled statistics update %s. Retrying later."), *EntryId.ToString());
+	ScheduleStatsJournalRetry(FailedEntry.RetryAttempts);
+}
+
+void UStatsEssentialsSubsystem::ScheduleStatsJournalRetry(const int32 RetryAttempts)
+{
+	// Exponential backoff, doubling the delay on every failed attempt.
+	const float Delay = FMath::Min(STATS_JOURNAL_RETRY_BASE_DELAY * FMath::Pow(2.0f, static_cast<float>(FMath::Max(RetryAttempts - 1, 0))), STATS_JOURNAL_RETRY_MAX_DELAY);
+	GetGameInstance()->GetTimerManager().SetTimer(
+		StatsJournalRetryTimerHandle,
+		FTimerDelegate::CreateUObject(this, &ThisClass::FlushStatsJournal),
+		Delay,
+		false);
+}
+
+bool UStatsEssentialsSubsystem::CanSendStatsJournalEntry(const FStatsJournalEntry& Entry) const
+{
+	if (Entry.RetryAttempts >= STATS_JOURNAL_MAX_RETRIES)
+	{
+		return false;
+	}
+
+	if (IsRunningDedicatedServer())
+	{
+		return true;
+	}
+
+	// Clients can only send the update with the credentials of the user who played the game.
+	const FUniqueNetIdPtr LocalUserId = IdentityPtr->GetUniquePlayerId(Entry.LocalUserNum);
+	return LocalUserId.IsValid()
+		&& IdentityPtr->GetLoginStatus(Entry.LocalUserNum) == ELoginStatus::LoggedIn
+		&& LocalUserId->ToString().Equals(Entry.OwnerUserId);
+}
+
+bool UStatsEssentialsSubsystem::HasStatsJournalEntryExpired(const FStatsJournalEntry& Entry) const
+{
+	return Entry.TotalAttempts >= STATS_JOURNAL_MAX_TOTAL_ATTEMPTS || FDateTime::UtcNow() - Entry.CreatedAt > STATS_JOURNAL_MAX_AGE;
+}
+
+void UStatsEssentialsSubsystem::DropStatsJournalEntry(const int32 EntryIndex, const FString& Reason)
+{
+	if (!StatsJournal.IsValidIndex(EntryIndex))
+	{
+		return;
+	}
+
+	// Log the whole update, it is the only record left of it.
+	FStatsJournalEntry& Entry = StatsJournal[EntryIndex];
+	TArray<FString> UserStatsStr;
+	for (const FOnlineStatsUserUpdatedStats& UserStats : Entry.UpdatedUsersStats)
+	{
+		for (const TPair<FString, FOnlineStatUpdate>& Stat : UserStats.Stats)
+		{
+			UserStatsStr.Add(FString::Printf(TEXT("%s/%s=%s"), *UserStats.Account->ToString(), *Stat.Key, *Stat.Value.GetValue().ToString()));
+		}
+	}
+	UE_LOG_STATSESSENTIALS(Error, TEXT("Dropping journaled statistics update %s after %d failed attempts, %s. Stats: %s"),
+		*Entry.EntryId.ToString(), Entry.TotalAttempts, *Reason, *FString::Join(UserStatsStr, TEXT(", ")));
+
+	// Let the original requester know, if the update was never attempted in this session.
+	const FOnlineError DroppedError = FOnlineError::CreateError(TEXT(""), EOnlineErrorResult::RequestFailure, TEXT(""), FText::FromString(Reason));
+	Entry.OnCompleteClient.ExecuteIfBound(DroppedError);
+	Entry.OnCompleteServer.ExecuteIfBound(DroppedError, {});
+
+	StatsJournal.RemoveAt(EntryIndex);
+}
+
+bool UStatsEssentialsSubsystem::IsStatsJournalErrorRetryable(const FOnlineError& Result)
+{
+	// Errors without a numeric code come from the client side, e.g. the request couldn't be sent.
+	if (!Result.ErrorCode.IsNumeric())
+	{
+		return true;
+	}
+
+	// HTTP status codes: timeouts, throttling and server errors are transient, other client errors are not.
+	const int32 ErrorCode = FCString::Atoi(*Result.ErrorCode);
+	if (ErrorCode >= 400 && ErrorCode < 500)
+	{
+		return ErrorCode == 408 || ErrorCode == 429;
+	}
+
+	// AccelByte error codes: the 14xxx range is raised by the SDK itself (e.g. network errors), the other
+	// service codes mean the backend processed and rejected the request (e.g. unknown stat code).
+	if (ErrorCode >= 10000)
+	{
+		return ErrorCode >= 14000 && ErrorCode < 15000;
+	}
+
+	return true;
+}
+
+FStatsJournalEntry* UStatsEssentialsSubsystem::FindStatsJournalEntry(const FGuid& EntryId)
+{
+	return StatsJournal.FindByPredicate([&EntryId](const FStatsJournalEntry& Entry) { return Entry.EntryId == EntryId; });
+}
+
+void UStatsEssentialsSubsystem::LoadStatsJournal()
+{
+	FString JsonStr;
+	if (!FFileHelper::LoadFileToString(JsonStr, *GetStatsJournalFilePath()))
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> JsonObject;
+	const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(JsonStr);
+	const TArray<TSharedPtr<FJsonValue>>* EntriesJson = nullptr;
+	int32 Version = 0;
+	if (!FJsonSerializer::Deserialize(JsonReader, JsonObject)
+		|| !JsonObject.IsValid()
+		|| !JsonObject->TryGetNumberField(TEXT("Version"), Version)
+		|| Version != STATS_JOURNAL_VERSION
+		|| !JsonObject->TryGetArrayField(TEXT("Entries"), EntriesJson))
+	{
+		UE_LOG_STATSESSENTIALS(Warning, TEXT("Failed to load statistics journal from: %s"), *GetStatsJournalFilePath());
+		return;
+	}
+
+	for (const TSharedPtr<FJsonValue>& EntryValue : *EntriesJson)
+	{
+		const TSharedPtr<FJsonObject>* EntryJson = nullptr;
+		const TArray<TSharedPtr<FJsonValue>>* UsersJson = nullptr;
+		FString EntryIdStr;
+		if (!EntryValue.IsValid()
+			|| !EntryValue->TryGetObject(EntryJson)
+			|| !(*EntryJson)->TryGetStringField(TEXT("EntryId"), EntryIdStr)
+			|| !(*EntryJson)->TryGetArrayField(TEXT("Users"), UsersJson))
+		{
+			continue;
+		}
+
+		FStatsJournalEntry Entry;
+		if (!FGuid::Parse(EntryIdStr, Entry.EntryId) || FindStatsJournalEntry(Entry.EntryId))
+		{
+			continue;
+		}
+		(*EntryJson)->TryGetNumberField(TEXT("LocalUserNum"), Entry.LocalUserNum);
+		(*EntryJson)->TryGetStringField(TEXT("OwnerUserId"), Entry.OwnerUserId);
+		(*EntryJson)->TryGetNumberField(TEXT("TotalAttempts"), Entry.TotalAttempts);
+
+		FString CreatedAtStr;
+		if ((*EntryJson)->TryGetStringField(TEXT("CreatedAt"), CreatedAtStr))
+		{
+			FDateTime::ParseIso8601(*CreatedAtStr, Entry.CreatedAt);
+		}
+
+		for (const TSharedPtr<FJsonValue>& UserValue : *UsersJson)
+		{
+			const TSharedPtr<FJsonObject>* UserJson = nullptr;
+			const TArray<TSharedPtr<FJsonValue>>* StatsJson = nullptr;
+			FString UserIdStr;
+			if (!UserValue.IsValid()
+				|| !UserValue->TryGetObject(UserJson)
+				|| !(*UserJson)->TryGetStringField(TEXT("UserId"), UserIdStr)
+				|| !(*UserJson)->TryGetArrayField(TEXT("Stats"), StatsJson))
+			{
+				continue;
+			}
+
+			const FUniqueNetIdPtr UserId = IdentityPtr->CreateUniquePlayerId(UserIdStr);
+			if (!UserId.IsValid())
+			{
+				continue;
+			}
+
+			FOnlineStatsUserUpdatedStats UserStats(UserId.ToSharedRef());
+			for (const TSharedPtr<FJsonValue>& StatValue : *StatsJson)
+			{
+				const TSharedPtr<FJsonObject>* StatJson = nullptr;
+				FString Code, ValueStr;
+				int32 ValueType = 0, ModificationType = 0;
+				if (!StatValue.IsValid()
+					|| !StatValue->TryGetObject(StatJson)
+					|| !(*StatJson)->TryGetStringField(TEXT("Code"), Code)
+					|| !(*StatJson)->TryGetStringField(TEXT("Value"), ValueStr)
+					|| !(*StatJson)->TryGetNumberField(TEXT("Type"), ValueType)
+					|| !(*StatJson)->TryGetNumberField(TEXT("Modification"), ModificationType))
+				{
+					continue;
+				}
+
+				// Stats values are either integers or floating points, restore the value with its original type.
+				FOnlineStatValue Value;
+				switch (static_cast<EOnlineKeyValuePairDataType::Type>(ValueType))
+				{
+				case EOnlineKeyValuePairDataType::Int32:
+					Value.SetValue(FCString::Atoi(*ValueStr));
+					break;
+				case EOnlineKeyValuePairDataType::Int64:
+					Value.SetValue(FCString::Atoi64(*ValueStr));
+					break;
+				case EOnlineKeyValuePairDataType::Float:
+					Value.SetValue(FCString::Atof(*ValueStr));
+					break;
+				case EOnlineKeyValuePairDataType::Double:
+					Value.SetValue(FCString::Atod(*ValueStr));
+					break;
+				default:
+					continue;
+				}
+
+				UserStats.Stats.Add(Code, FOnlineStatUpdate(Value, static_cast<FOnlineStatUpdate::EOnlineStatModificationType>(ModificationType)));
+			}
+
+			Entry.UpdatedUsersStats.Add(UserStats);
+		}
+
+		if (!Entry.UpdatedUsersStats.IsEmpty())
+		{
+			StatsJournal.Add(Entry);
+		}
+	}
+
+	UE_LOG_STATSESSENTIALS(Log, TEXT("Loaded %d journaled statistics updates."), StatsJournal.Num());
+}
+
+bool UStatsEssentialsSubsystem::SaveStatsJournal() const
+{
+	TArray<TSharedPtr<FJsonValue>> EntriesJson;
+	for (const FStatsJournalEntry& Entry : StatsJournal)
+	{
+		TArray<TSharedPtr<FJsonValue>> UsersJson;
+		for (const FOnlineStatsUserUpdatedStats& UserStats : Entry.UpdatedUsersStats)
+		{
+			TArray<TSharedPtr<FJsonValue>> StatsJson;
+			for (const TPair<FString, FOnlineStatUpdate>& Stat : UserStats.Stats)
+			{
+				TSharedRef<FJsonObject> StatJson = MakeShared<FJsonObject>();
+				StatJson->SetStringField(TEXT("Code"), Stat.Key);
+				StatJson->SetStringField(TEXT("Value"), Stat.Value.GetValue().ToString());
+				StatJson->SetNumberField(TEXT("Type"), static_cast<int32>(Stat.Value.GetValue().GetType()));
+				StatJson->SetNumberField(TEXT("Modification"), static_cast<int32>(Stat.Value.GetModificationType()));
+				StatsJson.Add(MakeShared<FJsonValueObject>(StatJson));
+			}
+
+			TSharedRef<FJsonObject> UserJson = MakeShared<FJsonObject>();
+			UserJson->SetStringField(TEXT("UserId"), UserStats.Account->ToString());
+			UserJson->SetArrayField(TEXT("Stats"), StatsJson);
+			UsersJson.Add(MakeShared<FJsonValueObject>(UserJson));
+		}
+
+		TSharedRef<FJsonObject> EntryJson = MakeShared<FJsonObject>();
+		EntryJson->SetStringField(TEXT("EntryId"), Entry.EntryId.ToString());
+		EntryJson->SetNumberField(TEXT("LocalUserNum"), Entry.LocalUserNum);
+		EntryJson->SetStringField(TEXT("OwnerUserId"), Entry.OwnerUserId);
+		EntryJson->SetNumberField(TEXT("TotalAttempts"), Entry.TotalAttempts);
+		EntryJson->SetStringField(TEXT("CreatedAt"), Entry.CreatedAt.ToIso8601());
+		EntryJson->SetArrayField(TEXT("Users"), UsersJson);
+		EntriesJson.Add(MakeShared<FJsonValueObject>(EntryJson));
+	}
+
+	TSharedRef<FJsonObject> JsonObject = MakeShared<FJsonObject>();
+	JsonObject->SetNumberField(TEXT("Version"), STATS_JOURNAL_VERSION);
+	JsonObject->SetArrayField(TEXT("Entries"), EntriesJson);
+
+	FString JsonStr;
+	const TSharedRef<TJsonWriter<TCHAR>> JsonWriter = TJsonWriterFactory<TCHAR>::Create(&JsonStr);
+	if (FJsonSerializer::Serialize(JsonObject, JsonWriter) && FFileHelper::SaveStringToFile(JsonStr, *GetStatsJournalFilePath()))
+	{
+		return true;
+	}
+
+	UE_LOG_STATSESSENTIALS(Warning, TEXT("Failed to save statistics journal to: %s"), *GetStatsJournalFilePath());
+	return false;
+}
+
+FString UStatsEssentialsSubsystem::GetStatsJournalFilePath() const
+{
+	FString CachePath = TEXT("");
+#if (defined(PLATFORM_PS4) && PLATFORM_PS4) || (defined(PLATFORM_PS5) && PLATFORM_PS5)
+	CachePath = FPaths::ProjectPersistentDownloadDir();
+#else
+	CachePath = FPaths::ProjectSavedDir();
+#endif
+
+	// Servers and clients may run from the same project directory, so they keep separate journals.
+	return FPaths::Combine(CachePath, STATS_JOURNAL_DIR, IsRunningDedicatedServer() ? TEXT("Server.json") : TEXT("Client.json"));
+}
+#pragma endregion
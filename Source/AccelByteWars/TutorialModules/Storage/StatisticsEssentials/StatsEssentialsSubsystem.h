@@ -6,6 +6,7 @@
 
 #include "CoreMinimal.h"
 #include "StatsEssentialsLog.h"
+#include "StatsEssentialsModels.h"
 #include "Core/AssetManager/TutorialModules/TutorialModuleSubsystem.h"
 #include "OnlineStatisticInterfaceAccelByte.h"
 #include "StatsEssentialsSubsystem.generated.h"
@@ -91,4 +92,37 @@ private:
 	FOnlineStatsUpdateStatsComplete OnUpdateStatsComplete;
 	FOnUpdateMultipleUserStatItemsComplete OnServerUpdateStatsComplete;
 // @@@SNIPEND
+
+#pragma region "Stats Journal"
+	/**
+	 * @brief Write the stats update to the local journal, then send it. The update stays in the journal
+	 * until the backend accepts it, and failed updates are sent again with backoff.
+	 * @return True if the update is journaled, false if there is nothing to update.
+	 */
+	bool SubmitUsersStats(
+		const int32 LocalUserNum,
+		const TArray<FOnlineStatsUserUpdatedStats>& UpdatedUsersStats,
+		const FOnlineStatsUpdateStatsComplete& OnCompleteClient,
+		const FOnUpdateMultipleUserStatItemsComplete& OnCompleteServer);
+
+	void FlushStatsJournal();
+	void OnStatsJournalEntrySent(const FGuid EntryId, const FOnlineError& Result);
+	void ScheduleStatsJournalRetry(const int32 RetryAttempts);
+	bool CanSendStatsJournalEntry(const FStatsJournalEntry& Entry) const;
+	bool HasStatsJournalEntryExpired(const FStatsJournalEntry& Entry) const;
+	void DropStatsJournalEntry(const int32 EntryIndex, const FString& Reason);
+	static bool IsStatsJournalErrorRetryable(const FOnlineError& Result);
+	FStatsJournalEntry* FindStatsJournalEntry(const FGuid& EntryId);
+
+	void LoadStatsJournal();
+	bool SaveStatsJournal() const;
+	FString GetStatsJournalFilePath() const;
+
+	TArray<FStatsJournalEntry> StatsJournal;
+
+	// Id of the journal entry being sent, invalid if none.
+	FGuid SendingStatsJournalEntryId;
+
+	FTimerHandle StatsJournalRetryTimerHandle;
+#pragma endregion
 };